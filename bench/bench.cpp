@@ -0,0 +1,353 @@
+/***************************************************************************************/
+/*                                                                                     */
+/*                        high-performance matrix benchmark suite                      */
+/*                                                                                     */
+/*   usage: hpmx_bench [--sizes=64,256,1024] [--types=float,double,int,bf16,fp16,int8] */
+/*                     [--ops=constructor,...] [--policies=seq,par] [--min-time=0.2]   */
+/*                     [--repetitions=5] [--format=table|csv|json] [--out=file]        */
+/*                     [--baseline=file.csv] [--tolerance=0.10] [--tune=cache.txt]     */
+/*                                                                                     */
+/*   Every (operation, type, policy, size) point is calibrated to run for at least     */
+/*   min-time seconds per repetition; the median repetition is reported as ns/op,      */
+/*   GB/s (compulsory traffic) and GFLOP/s. With --baseline, points more than          */
+/*   tolerance slower than a previous CSV run are listed and the exit code is 2.       */
+/*   With --tune, the kernels are autotuned (or the cached tuning is reused) first.    */
+/*                                                                                     */
+/***************************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "hpmx.h"
+
+using namespace hpmx;
+
+// one measured point
+struct record {
+	std::string operation;
+	std::string type;
+	std::string policy;
+	size_t rows;
+	size_t columns;
+	size_t depth;
+	size_t iterations;
+	double ns_per_op;
+	double gb_per_s;
+	double gflop_per_s;
+};
+
+// command-line settings
+struct settings {
+	std::vector<size_t> sizes{ 64u, 256u, 1024u };
+	std::vector<std::string> types{ "float", "double", "int" };
+	std::vector<std::string> operations{ "constructor", "generator", "apply", "addition", "subtraction", "multiplication", "transpose", "batched", "random", "sum", "column_sum", "row", "column" };
+	std::vector<std::string> policies{ "seq", "par" };
+	double min_time{ 0.2 };
+	size_t repetitions{ 5u };
+	std::string format{ "table" };
+	std::string out;
+	std::string baseline;
+	double tolerance{ 0.10 };
+	std::string tune;
+};
+
+// keeps results observable so the timed work is not optimized away
+volatile double sink{ 0.0 };
+
+// splits a comma-separated list
+auto split = [](const std::string & text) {
+	std::vector<std::string> retlst;
+	std::stringstream stream{ text };
+	for (std::string item; std::getline(stream, item, ',');)
+		if (!item.empty())
+			retlst.push_back(item);
+	return retlst;
+};
+
+// parses --key=value arguments
+auto parse = [](int argc, char** argv) {
+	settings retset;
+	for (int k{ 1 }; k < argc; ++k) {
+		std::string argument{ argv[k] };
+		auto separator{ argument.find('=') };
+		auto key{ argument.substr(0u, separator) };
+		auto value{ separator == std::string::npos ? std::string{} : argument.substr(separator + 1u) };
+		if (key == "--sizes") {
+			retset.sizes.clear();
+			for (const auto& item : split(value))
+				retset.sizes.push_back(std::stoul(item));
+		}
+		else if (key == "--types") retset.types = split(value);
+		else if (key == "--ops") retset.operations = split(value);
+		else if (key == "--policies") retset.policies = split(value);
+		else if (key == "--min-time") retset.min_time = std::stod(value);
+		else if (key == "--repetitions") retset.repetitions = std::max<size_t>(std::stoul(value), 1u);
+		else if (key == "--format") retset.format = value;
+		else if (key == "--out") retset.out = value;
+		else if (key == "--baseline") retset.baseline = value;
+		else if (key == "--tolerance") retset.tolerance = std::stod(value);
+		else if (key == "--tune") retset.tune = value;
+		else
+			throw std::runtime_error("Exception from hpmx_bench: unknown argument " + argument);
+	}
+	return retset;
+};
+
+// calibrates the iteration count to min_time, then returns (median ns per call, iterations)
+auto measure = [](auto && fn, double min_time, size_t repetitions) {
+	using clock = std::chrono::steady_clock;
+	auto run = [&fn](size_t iterations) {
+		auto start{ clock::now() };
+		for (size_t k{ 0u }; k < iterations; ++k)
+			fn();
+		return std::chrono::duration<double>(clock::now() - start).count();
+	};
+	size_t iterations{ 1u };
+	for (auto elapsed{ run(iterations) }; elapsed < min_time && iterations < (size_t(1u) << 30u);) {
+		auto scale{ elapsed > 0.0 ? std::min(min_time / elapsed * 1.2, 10.0) : 10.0 };
+		iterations = std::max(iterations + 1u, size_t(double(iterations) * scale));
+		elapsed = run(iterations);
+	}
+	std::vector<double> samples;
+	for (size_t r{ 0u }; r < repetitions; ++r)
+		samples.push_back(run(iterations) * 1e9 / double(iterations));
+	std::nth_element(samples.begin(), samples.begin() + samples.size() / 2u, samples.end());
+	return std::make_pair(samples[samples.size() / 2u], iterations);
+};
+
+// benchmarks every selected operation for element type T at size n x n
+template<typename T>
+void sweep(const settings & cfg, const std::string & type, size_t n, std::vector<record> & records) {
+	auto lhs{ real::valued::matrix::generator(n, n, [k = 0u]() mutable { return T((k++ % 7u) + 1u); }) };
+	auto rhs{ real::valued::matrix::generator(n, n, [k = 0u]() mutable { return T((k++ % 5u) + 1u); }) };
+	auto elements{ double(n) * double(n) };
+	auto bytes{ elements * sizeof(T) };
+
+	auto emit = [&](const std::string & operation, const std::string & policy, size_t depth, double traffic, double flops, auto && fn) {
+		auto [ns, iterations] { measure(fn, cfg.min_time, cfg.repetitions) };
+		records.push_back({ operation, type, policy, n, n, depth, iterations, ns, traffic / ns, flops / ns });
+	};
+	auto selected = [&cfg](const std::string & operation) {
+		return std::find(cfg.operations.begin(), cfg.operations.end(), operation) != cfg.operations.end();
+	};
+
+	// policy-agnostic operations
+	if (selected("constructor"))
+		emit("constructor", "seq", 0u, bytes, 0.0, [&] {
+			auto mat{ real::valued::matrix::constructor(n, n, T(1)) };
+			sink = double(std::get<real::valued::matrix::data_>(mat)[0]);
+		});
+	if (selected("generator"))
+		emit("generator", "seq", 0u, bytes, 0.0, [&] {
+			auto mat{ real::valued::matrix::generator(n, n, [] { return T(1); }) };
+			sink = double(std::get<real::valued::matrix::data_>(mat)[0]);
+		});
+	if (selected("row"))
+		emit("row", "seq", 0u, 2.0 * bytes, 0.0, [&] {
+			for (size_t i{ 0u }; i < n; ++i) {
+				std::valarray<T> row{ real::valued::matrix::get::row::copy(lhs, i) };
+				sink = double(row[0]);
+			}
+		});
+	if (selected("column"))
+		emit("column", "seq", 0u, 2.0 * bytes, 0.0, [&] {
+			for (size_t j{ 0u }; j < n; ++j) {
+				std::valarray<T> column{ real::valued::matrix::get::column::copy(lhs, j) };
+				sink = double(column[0]);
+			}
+		});
+
+	// operations taking an execution policy
+	auto timed = [&](const std::string & policy, const auto & execution) {
+		if (selected("apply"))
+			emit("apply", policy, 0u, 2.0 * bytes, 2.0 * elements, [&] {
+				auto mat{ real::valued::matrix::apply(lhs, [](T x) { return T(x * T(2) + T(1)); }, execution) };
+				sink = double(std::get<real::valued::matrix::data_>(mat)[0]);
+			});
+		if (selected("addition"))
+			emit("addition", policy, 0u, 3.0 * bytes, elements, [&] {
+				auto mat{ real::valued::matrix::addition(lhs, rhs, execution) };
+				sink = double(std::get<real::valued::matrix::data_>(mat)[0]);
+			});
+		if (selected("subtraction"))
+			emit("subtraction", policy, 0u, 3.0 * bytes, elements, [&] {
+				auto mat{ real::valued::matrix::subtraction(lhs, rhs, execution) };
+				sink = double(std::get<real::valued::matrix::data_>(mat)[0]);
+			});
+		if (selected("multiplication"))
+			emit("multiplication", policy, n, 3.0 * bytes, 2.0 * elements * double(n), [&] {
+				auto mat{ real::valued::matrix::multiplication(lhs, rhs, execution) };
+				sink = double(std::get<real::valued::matrix::data_>(mat)[0]);
+			});
+		// batches are stored in arithmetic types only
+		if constexpr (std::is_arithmetic_v<T>) {
+			if (selected("batched")) {
+				// the n x n operands reinterpreted as n * n / 64 pairs of 8 x 8 matrices
+				auto count{ n * n / 64u };
+				auto blhs{ real::valued::matrix::batched::strided(&std::as_const(std::get<real::valued::matrix::data_>(lhs))[0], 8u, 8u, count) };
+				auto brhs{ real::valued::matrix::batched::strided(&std::as_const(std::get<real::valued::matrix::data_>(rhs))[0], 8u, 8u, count) };
+				emit("batched", policy, 8u, 3.0 * bytes, 2.0 * elements * 8.0, [&] {
+					auto bat{ real::valued::matrix::batched::multiplication(blhs, brhs, execution) };
+					sink = double(std::get<real::valued::matrix::data_>(bat)[0]);
+				});
+			}
+		}
+		// counter-based fills are floating-point only
+		if constexpr (std::is_floating_point_v<T>) {
+			if (selected("random"))
+				emit("random", policy, 0u, bytes, 0.0, [&] {
+					auto mat{ real::valued::matrix::random::uniform(n, n, 1u, T(0), T(1), execution) };
+					sink = double(std::get<real::valued::matrix::data_>(mat)[0]);
+				});
+		}
+		if (selected("sum"))
+			emit("sum", policy, 0u, bytes, elements, [&] {
+				sink = double(real::valued::matrix::reduce::sum(lhs, execution));
+			});
+		if (selected("column_sum"))
+			emit("column_sum", policy, 0u, bytes, elements, [&] {
+				auto sums{ real::valued::matrix::reduce::column::sum(lhs, execution) };
+				sink = double(sums[0]);
+			});
+		if (selected("transpose"))
+			emit("transpose", policy, 0u, 2.0 * bytes, 0.0, [&] {
+				auto mat{ real::valued::matrix::transpose(lhs, execution) };
+				sink = double(std::get<real::valued::matrix::data_>(mat)[0]);
+			});
+	};
+	for (const auto& policy : cfg.policies) {
+		if (policy == "seq")
+			timed(policy, std::execution::seq);
+		else if (policy == "par")
+			timed(policy, std::execution::par);
+		else
+			throw std::runtime_error("Exception from hpmx_bench: unknown policy " + policy);
+	}
+}
+
+// benchmarks the int8 quantized multiplication at size n x n (the only quantized operation)
+void sweep_quantized(const settings & cfg, size_t n, std::vector<record> & records) {
+	auto lhs{ real::valued::matrix::quantized::quantize(real::valued::matrix::generator(n, n, [k = 0u]() mutable { return float((k++ % 7u) + 1u); })) };
+	auto rhs{ real::valued::matrix::quantized::quantize(real::valued::matrix::generator(n, n, [k = 0u]() mutable { return float((k++ % 5u) + 1u); })) };
+	auto elements{ double(n) * double(n) };
+	if (std::find(cfg.operations.begin(), cfg.operations.end(), "multiplication") == cfg.operations.end())
+		return;
+	for (const auto& policy : cfg.policies) {
+		auto run = [&](const auto & execution) {
+			auto [ns, iterations] { measure([&] {
+				auto mat{ real::valued::matrix::multiplication(lhs, rhs, execution) };
+				sink = double(std::get<real::valued::matrix::data_>(mat)[0]);
+			}, cfg.min_time, cfg.repetitions) };
+			records.push_back({ "multiplication", "int8", policy, n, n, n, iterations, ns, (2.0 + 4.0) * elements / ns, 2.0 * elements * double(n) / ns });
+		};
+		if (policy == "seq")
+			run(std::execution::seq);
+		else if (policy == "par")
+			run(std::execution::par);
+		else
+			throw std::runtime_error("Exception from hpmx_bench: unknown policy " + policy);
+	}
+}
+
+// machine-readable and human-readable writers
+auto write_csv = [](std::ostream & os, const std::vector<record> & records) {
+	os << "operation,type,policy,rows,columns,depth,iterations,ns_per_op,gb_per_s,gflop_per_s\n";
+	os << std::setprecision(6);
+	for (const auto& r : records)
+		os << r.operation << ',' << r.type << ',' << r.policy << ',' << r.rows << ',' << r.columns << ',' << r.depth << ','
+			<< r.iterations << ',' << r.ns_per_op << ',' << r.gb_per_s << ',' << r.gflop_per_s << '\n';
+};
+
+auto write_json = [](std::ostream & os, const std::vector<record> & records) {
+	os << "{\n  \"threads\": " << concurrency::default_pool().size() + 1u << ",\n  \"results\": [\n" << std::setprecision(6);
+	for (size_t k{ 0u }; k < records.size(); ++k) {
+		const auto& r{ records[k] };
+		os << "    { \"operation\": \"" << r.operation << "\", \"type\": \"" << r.type << "\", \"policy\": \"" << r.policy
+			<< "\", \"rows\": " << r.rows << ", \"columns\": " << r.columns << ", \"depth\": " << r.depth
+			<< ", \"iterations\": " << r.iterations << ", \"ns_per_op\": " << r.ns_per_op
+			<< ", \"gb_per_s\": " << r.gb_per_s << ", \"gflop_per_s\": " << r.gflop_per_s << " }"
+			<< (k + 1u < records.size() ? ",\n" : "\n");
+	}
+	os << "  ]\n}\n";
+};
+
+auto write_table = [](std::ostream & os, const std::vector<record> & records) {
+	os << std::left << std::setw(16) << "operation" << std::setw(8) << "type" << std::setw(8) << "policy"
+		<< std::right << std::setw(8) << "size" << std::setw(16) << "ns/op" << std::setw(12) << "GB/s" << std::setw(12) << "GFLOP/s" << '\n';
+	for (const auto& r : records)
+		os << std::left << std::setw(16) << r.operation << std::setw(8) << r.type << std::setw(8) << r.policy
+			<< std::right << std::setw(8) << r.rows << std::fixed << std::setprecision(1) << std::setw(16) << r.ns_per_op
+			<< std::setprecision(2) << std::setw(12) << r.gb_per_s << std::setw(12) << r.gflop_per_s << '\n' << std::defaultfloat;
+};
+
+// lists points slower than the baseline CSV by more than the tolerance; returns their count
+auto compare = [](const std::string & path, const std::vector<record> & records, double tolerance) {
+	std::ifstream file{ path };
+	if (!file)
+		throw std::runtime_error("Exception from hpmx_bench: cannot read baseline " + path);
+	std::map<std::tuple<std::string, std::string, std::string, size_t, size_t, size_t>, double> baseline;
+	std::string line;
+	std::getline(file, line);
+	while (std::getline(file, line)) {
+		auto fields{ split(line) };
+		if (fields.size() >= 8u)
+			baseline[{ fields[0], fields[1], fields[2], std::stoul(fields[3]), std::stoul(fields[4]), std::stoul(fields[5]) }] = std::stod(fields[7]);
+	}
+	size_t regressions{ 0u };
+	for (const auto& r : records) {
+		auto it{ baseline.find({ r.operation, r.type, r.policy, r.rows, r.columns, r.depth }) };
+		if (it != baseline.end() && r.ns_per_op > it->second * (1.0 + tolerance)) {
+			std::cerr << "regression: " << r.operation << ' ' << r.type << ' ' << r.policy << ' ' << r.rows
+				<< ": " << it->second << " -> " << r.ns_per_op << " ns/op\n";
+			++regressions;
+		}
+	}
+	return regressions;
+};
+
+// entry point
+auto main(int argc, char** argv) -> int {
+	try {
+		auto cfg{ parse(argc, argv) };
+		if (!cfg.tune.empty())
+			real::valued::matrix::tuning::tune(cfg.tune, std::execution::par);
+		std::vector<record> records;
+		for (auto n : cfg.sizes)
+			for (const auto& type : cfg.types) {
+				if (type == "float") sweep<float>(cfg, type, n, records);
+				else if (type == "double") sweep<double>(cfg, type, n, records);
+				else if (type == "int") sweep<int>(cfg, type, n, records);
+				else if (type == "bf16") sweep<precision::bfloat16>(cfg, type, n, records);
+				else if (type == "fp16") sweep<precision::float16>(cfg, type, n, records);
+				else if (type == "int8") sweep_quantized(cfg, n, records);
+				else throw std::runtime_error("Exception from hpmx_bench: unknown type " + type);
+			}
+
+		std::ofstream file;
+		if (!cfg.out.empty()) {
+			file.open(cfg.out);
+			if (!file)
+				throw std::runtime_error("Exception from hpmx_bench: cannot write " + cfg.out);
+		}
+		auto& os{ cfg.out.empty() ? std::cout : static_cast<std::ostream&>(file) };
+		if (cfg.format == "csv") write_csv(os, records);
+		else if (cfg.format == "json") write_json(os, records);
+		else write_table(os, records);
+
+		if (!cfg.baseline.empty() && compare(cfg.baseline, records, cfg.tolerance) > 0u)
+			return 2;
+		return EXIT_SUCCESS;
+	}
+	catch (const std::exception & xxx) {
+		std::cerr << xxx.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+}
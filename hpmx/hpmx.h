@@ -16,19 +16,866 @@
 #include <algorithm>
 #include <execution>
 #include <numeric>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <new>
+#include <limits>
+
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <stdexcept>
+#include <future>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <deque>
+#include <memory_resource>
+#include <utility>
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
 
 #include <initializer_list>
 #include <valarray>
+#include <array>
 #include <vector>
 #include <tuple>
+#include <optional>
 #include <list>
 #include <set>
+#include <map>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// opt-in instrumentation probe: HPMX_INSTRUMENT(name, rows, columns, flops, bytes) measures the enclosing
+// block as one call of the operation `name` when HPMX_INSTRUMENTATION is defined, and is nothing otherwise
+#if defined(HPMX_INSTRUMENTATION)
+#define HPMX_INSTRUMENT(name, rows, columns, flops, bytes) \
+	static auto& hpmx_instrumentation_site_{ ::hpmx::instrumentation::site(name) }; \
+	::hpmx::instrumentation::scope hpmx_instrumentation_scope_{ hpmx_instrumentation_site_, (rows), (columns), (flops), (bytes) }
+#else
+#define HPMX_INSTRUMENT(name, rows, columns, flops, bytes) ((void)0)
+#endif
+
+// runtime instruction set dispatch of the hot kernels (gcc/clang on x86; HPMX_NO_DISPATCH keeps the build's
+// own instruction set): HPMX_INLINE bodies are generated inside avx2 and avx-512 trampolines
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(HPMX_NO_DISPATCH)
+#define HPMX_DISPATCH
+#endif
+#if defined(__GNUC__)
+#define HPMX_INLINE __attribute__((always_inline))
+#else
+#define HPMX_INLINE
+#endif
 
 /***************************************************************************************/
 /* high-performance matrix space                                                       */
 /***************************************************************************************/
 namespace hpmx {
 
+	/***********************************************************************************/
+	/* concurrency space                                                               */
+	/***********************************************************************************/
+	namespace concurrency {
+
+		// explicit thread-count execution policy (the calling thread counts as one of them)
+		struct threads {
+			size_t count;
+		};
+
+		// number of elements (or equivalent units of work) below which an operation stays on the calling thread
+		inline size_t parallel_grain{ 32768u };
+
+		// work-stealing thread pool: each worker owns a task deque, pops its own tasks LIFO and steals others' FIFO
+		class thread_pool {
+		public:
+			explicit thread_pool(size_t number_of_workers) : queues_(std::max<size_t>(number_of_workers, 1u)) {
+				workers_.reserve(queues_.size());
+				for (size_t i{ 0u }; i < queues_.size(); ++i)
+					workers_.emplace_back([this, i] { run(i); });
+			}
+
+			thread_pool(const thread_pool&) = delete;
+			thread_pool& operator=(const thread_pool&) = delete;
+
+			~thread_pool() {
+				{
+					std::lock_guard<std::mutex> lock{ mutex_ };
+					stopping_ = true;
+				}
+				wake_.notify_all();
+				for (auto& worker : workers_)
+					worker.join();
+			}
+
+			// number of worker threads
+			size_t size() const noexcept { return workers_.size(); }
+
+			// enqueues a task on the submitting worker's own deque, or round-robin when submitted from outside the pool
+			void submit(std::function<void()> task) {
+				auto target{ current_ == this ? index_ : next_.fetch_add(1u, std::memory_order_relaxed) % queues_.size() };
+				{
+					std::lock_guard<std::mutex> lock{ queues_[target].mutex };
+					queues_[target].tasks.push_back(std::move(task));
+				}
+				{
+					std::lock_guard<std::mutex> lock{ mutex_ };
+					++pending_;
+				}
+				wake_.notify_one();
+			}
+
+			// enqueues a callable and returns the future of its result
+			template<typename F>
+			auto async(F&& fn) {
+				using result_type = std::invoke_result_t<std::decay_t<F> >;
+				auto task{ std::make_shared<std::packaged_task<result_type()> >(std::forward<F>(fn)) };
+				auto result{ task->get_future() };
+				submit([task] { (*task)(); });
+				return result;
+			}
+
+		private:
+			struct queue {
+				std::mutex mutex;
+				std::deque<std::function<void()> > tasks;
+			};
+
+			bool take(size_t index, std::function<void()>& task) {
+				for (size_t attempt{ 0u }; attempt < queues_.size(); ++attempt) {
+					auto& victim{ queues_[(index + attempt) % queues_.size()] };
+					std::lock_guard<std::mutex> lock{ victim.mutex };
+					if (!victim.tasks.empty()) {
+						if (attempt == 0u) {
+							task = std::move(victim.tasks.back());
+							victim.tasks.pop_back();
+						}
+						else {
+							task = std::move(victim.tasks.front());
+							victim.tasks.pop_front();
+						}
+						std::lock_guard<std::mutex> count_lock{ mutex_ };
+						--pending_;
+						return true;
+					}
+				}
+				return false;
+			}
+
+			void run(size_t index) {
+				current_ = this;
+				index_ = index;
+				for (;;) {
+					std::function<void()> task;
+					if (take(index, task)) {
+						task();
+						continue;
+					}
+					std::unique_lock<std::mutex> lock{ mutex_ };
+					wake_.wait(lock, [this] { return stopping_ || pending_ > 0u; });
+					if (stopping_ && pending_ == 0u)
+						return;
+				}
+			}
+
+			std::vector<queue> queues_;
+			std::vector<std::thread> workers_;
+			std::mutex mutex_;
+			std::condition_variable wake_;
+			size_t pending_{ 0u };
+			bool stopping_{ false };
+			std::atomic<size_t> next_{ 0u };
+			inline static thread_local thread_pool* current_{ nullptr };
+			inline static thread_local size_t index_{ 0u };
+		};
+
+		// process-wide pool with one worker per hardware thread besides the caller
+		auto default_pool = []() -> thread_pool & {
+			static thread_pool pool{ std::max(2u, std::thread::hardware_concurrency()) - 1u };
+			return pool;
+		};
+
+		// number of threads requested by an optional execution policy (none or seq: the calling thread only)
+		auto degree = [](const auto &... policy) -> size_t {
+			size_t count{ 1u };
+			([&count](const auto & p) {
+				using policy_type = std::remove_cv_t<std::remove_reference_t<decltype(p)> >;
+				if constexpr (std::is_same_v<policy_type, threads>)
+					count = std::max<size_t>(p.count, 1u);
+				else if constexpr (std::is_execution_policy_v<policy_type> &&
+					!std::is_same_v<policy_type, std::execution::sequenced_policy>)
+					count = default_pool().size() + 1u;
+			}(policy), ...);
+			return count;
+		};
+
+		// runs fn(first, last) over [begin, end) in grain-sized chunks claimed dynamically by up to
+		// `concurrency` threads, the caller included; a range of a single chunk stays on the caller
+		auto parallel_for = [](size_t begin, size_t end, size_t grain, size_t concurrency, auto && fn) {
+			auto count{ end > begin ? end - begin : size_t(0u) };
+			grain = std::max<size_t>(grain, 1u);
+			auto chunks{ (count + grain - 1u) / grain };
+			auto participants{ std::min({ concurrency, chunks, default_pool().size() + 1u }) };
+			if (participants <= 1u) {
+				if (count > 0u)
+					fn(begin, end);
+				return;
+			}
+
+			struct state {
+				std::atomic<size_t> next{ 0u };
+				std::atomic<size_t> done{ 0u };
+				std::atomic<bool> failed{ false };
+				std::exception_ptr error;
+				std::mutex mutex;
+				std::condition_variable finished;
+			};
+			auto shared{ std::make_shared<state>() };
+			auto work = [shared, begin, end, grain, chunks, &fn]() {
+				for (auto chunk{ shared->next.fetch_add(1u) }; chunk < chunks; chunk = shared->next.fetch_add(1u)) {
+					if (!shared->failed.load(std::memory_order_relaxed)) {
+						try {
+							fn(begin + chunk * grain, std::min(end, begin + (chunk + 1u) * grain));
+						}
+						catch (...) {
+							std::lock_guard<std::mutex> lock{ shared->mutex };
+							if (!shared->error)
+								shared->error = std::current_exception();
+							shared->failed = true;
+						}
+					}
+					if (shared->done.fetch_add(1u) + 1u == chunks) {
+						std::lock_guard<std::mutex> lock{ shared->mutex };
+						shared->finished.notify_all();
+					}
+				}
+			};
+
+			for (size_t i{ 1u }; i < participants; ++i)
+				default_pool().submit(work);
+			work();
+
+			std::unique_lock<std::mutex> lock{ shared->mutex };
+			shared->finished.wait(lock, [&shared, chunks] { return shared->done.load() == chunks; });
+			if (shared->error)
+				std::rethrow_exception(shared->error);
+		};
+	}
+
+	/***********************************************************************************/
+	/* memory space                                                                    */
+	/***********************************************************************************/
+	namespace memory {
+
+		// storage alignment (one cache line, one AVX-512 register)
+		constexpr size_t alignment_ = 64u;
+
+		// pluggable allocators: any std::pmr::memory_resource can back a buffer
+		using pool = std::pmr::unsynchronized_pool_resource;			// single-threaded buffer reuse
+		using synchronized_pool = std::pmr::synchronized_pool_resource;	// thread-safe buffer reuse
+		using arena = std::pmr::monotonic_buffer_resource;				// bump allocation, released at once
+
+		// tag selecting construction without value-initialization
+		struct uninitialized_t {};
+		constexpr uninitialized_t uninitialized{};
+
+		// 64-byte aligned, resource-allocated contiguous storage with valarray-like element access
+		template<typename T>
+		class buffer {
+		public:
+			using value_type = T;
+
+			buffer() = default;
+
+			explicit buffer(size_t size, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+				: buffer(T(0), size, resource) {}
+
+			buffer(const T& value, size_t size, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+				: buffer(size, uninitialized, resource) {
+				std::fill_n(data_, size_, value);
+			}
+
+			buffer(size_t size, uninitialized_t, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+				: data_(allocate(size, resource)), size_(size), resource_(resource) {}
+
+			buffer(const buffer& other) : buffer(other.size_, uninitialized, other.resource_) {
+				std::copy_n(other.data_, size_, data_);
+			}
+
+			buffer(buffer&& other) noexcept
+				: data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0u)), resource_(other.resource_) {}
+
+			buffer& operator=(const buffer& other) {
+				if (this != &other) {
+					if (size_ != other.size_) {
+						buffer copy{ other.size_, uninitialized, resource_ };
+						swap(copy);
+					}
+					std::copy_n(other.data_, size_, data_);
+				}
+				return *this;
+			}
+
+			buffer& operator=(buffer&& other) noexcept {
+				if (this != &other) {
+					release();
+					data_ = std::exchange(other.data_, nullptr);
+					size_ = std::exchange(other.size_, 0u);
+					resource_ = other.resource_;
+				}
+				return *this;
+			}
+
+			~buffer() { release(); }
+
+			void swap(buffer& other) noexcept {
+				std::swap(data_, other.data_);
+				std::swap(size_, other.size_);
+				std::swap(resource_, other.resource_);
+			}
+
+			// reallocates to `size` value-initialized elements (valarray::resize semantics)
+			void resize(size_t size, const T& value = T()) {
+				if (size != size_) {
+					buffer resized{ size, uninitialized, resource_ };
+					swap(resized);
+				}
+				std::fill_n(data_, size_, value);
+			}
+
+			size_t size() const noexcept { return size_; }
+			T* data() noexcept { return data_; }
+			const T* data() const noexcept { return data_; }
+			T& operator[](size_t k) noexcept { return data_[k]; }
+			const T& operator[](size_t k) const noexcept { return data_[k]; }
+			T* begin() noexcept { return data_; }
+			T* end() noexcept { return data_ + size_; }
+			const T* begin() const noexcept { return data_; }
+			const T* end() const noexcept { return data_ + size_; }
+			std::pmr::memory_resource* resource() const noexcept { return resource_; }
+
+		private:
+			static T* allocate(size_t size, std::pmr::memory_resource* resource) {
+				return size == 0u ? nullptr : static_cast<T*>(resource->allocate(size * sizeof(T), alignment_));
+			}
+
+			void release() noexcept {
+				if (data_ != nullptr)
+					resource_->deallocate(data_, size_ * sizeof(T), alignment_);
+				data_ = nullptr;
+				size_ = 0u;
+			}
+
+			T* data_{ nullptr };
+			size_t size_{ 0u };
+			std::pmr::memory_resource* resource_{ std::pmr::get_default_resource() };
+		};
+
+		// memory mapping of a whole file, read-only or read-write; a nonzero `size` creates (or truncates)
+		// the file to that many zero bytes
+		class mapping {
+		public:
+			mapping() = default;
+
+			mapping(std::string_view path, bool writable, size_t size = 0u) : writable_(writable) {
+				std::string name{ path };
+#if defined(_WIN32)
+				handle_ = CreateFileA(name.c_str(), writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ, FILE_SHARE_READ, nullptr,
+					size > 0u ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+				if (handle_ == INVALID_HANDLE_VALUE)
+					fail("cannot open the file.");
+				LARGE_INTEGER length;
+				length.QuadPart = LONGLONG(size);
+				if (size == 0u && !GetFileSizeEx(handle_, &length))
+					fail("cannot query the file size.");
+				size_ = size_t(length.QuadPart);
+				if (size_ > 0u) {
+					view_ = CreateFileMappingA(handle_, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY,
+						DWORD(std::uint64_t(size_) >> 32u), DWORD(size_ & 0xffffffffu), nullptr);
+					if (view_ == nullptr)
+						fail("cannot map the file.");
+					data_ = static_cast<std::byte*>(MapViewOfFile(view_, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0));
+					if (data_ == nullptr)
+						fail("cannot map the file.");
+				}
+#else
+				descriptor_ = ::open(name.c_str(), writable ? (size > 0u ? O_RDWR | O_CREAT | O_TRUNC : O_RDWR) : O_RDONLY, 0644);
+				if (descriptor_ < 0)
+					fail("cannot open the file.");
+				if (size > 0u) {
+					if (::ftruncate(descriptor_, off_t(size)) != 0)
+						fail("cannot resize the file.");
+					size_ = size;
+				}
+				else {
+					struct stat status;
+					if (::fstat(descriptor_, &status) != 0)
+						fail("cannot query the file size.");
+					size_ = size_t(status.st_size);
+				}
+				if (size_ > 0u) {
+					auto* address{ ::mmap(nullptr, size_, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, descriptor_, 0) };
+					if (address == MAP_FAILED)
+						fail("cannot map the file.");
+					data_ = static_cast<std::byte*>(address);
+				}
+#endif
+			}
+
+			mapping(const mapping&) = delete;
+			mapping& operator=(const mapping&) = delete;
+
+			mapping(mapping&& other) noexcept { swap(other); }
+
+			mapping& operator=(mapping&& other) noexcept {
+				if (this != &other) {
+					close();
+					swap(other);
+				}
+				return *this;
+			}
+
+			~mapping() { close(); }
+
+			void swap(mapping& other) noexcept {
+				std::swap(data_, other.data_);
+				std::swap(size_, other.size_);
+				std::swap(writable_, other.writable_);
+#if defined(_WIN32)
+				std::swap(handle_, other.handle_);
+				std::swap(view_, other.view_);
+#else
+				std::swap(descriptor_, other.descriptor_);
+#endif
+			}
+
+			// asks the kernel to read [offset, offset + bytes) ahead of use (asynchronous)
+			void prefetch(size_t offset, size_t bytes) const noexcept {
+#if !defined(_WIN32)
+				advise(offset, bytes, MADV_WILLNEED);
+#else
+				(void)offset; (void)bytes;
+#endif
+			}
+
+			// drops [offset, offset + bytes) from the resident set; the file keeps the contents (written
+			// pages included) and later accesses fault them back in
+			void evict(size_t offset, size_t bytes) const noexcept {
+#if defined(_WIN32)
+				if (data_ != nullptr && bytes > 0u)
+					VirtualUnlock(data_ + offset, bytes);
+#else
+				advise(offset, bytes, MADV_DONTNEED);
+#endif
+			}
+
+			// writes modified pages back to the file
+			void flush() const {
+#if defined(_WIN32)
+				if (data_ != nullptr && writable_ && !FlushViewOfFile(data_, 0))
+					throw std::runtime_error("Exception from memory::mapping::flush: cannot write the mapping back.");
+#else
+				if (data_ != nullptr && writable_ && ::msync(data_, size_, MS_SYNC) != 0)
+					throw std::runtime_error("Exception from memory::mapping::flush: cannot write the mapping back.");
+#endif
+			}
+
+			size_t size() const noexcept { return size_; }
+			std::byte* data() const noexcept { return data_; }
+			bool writable() const noexcept { return writable_; }
+
+		private:
+			[[noreturn]] void fail(const char* reason) {
+				close();
+				throw std::runtime_error(std::string("Exception from memory::mapping: ") + reason);
+			}
+
+#if !defined(_WIN32)
+			void advise(size_t offset, size_t bytes, int advice) const noexcept {
+				if (data_ == nullptr || bytes == 0u || offset >= size_)
+					return;
+				static const auto page{ size_t(::sysconf(_SC_PAGESIZE)) };
+				auto first{ offset / page * page };
+				auto last{ std::min(offset + bytes, size_) };
+				::madvise(data_ + first, last - first, advice);
+			}
+#endif
+
+			void close() noexcept {
+#if defined(_WIN32)
+				if (data_ != nullptr)
+					UnmapViewOfFile(data_);
+				if (view_ != nullptr)
+					CloseHandle(view_);
+				if (handle_ != INVALID_HANDLE_VALUE)
+					CloseHandle(handle_);
+				view_ = nullptr;
+				handle_ = INVALID_HANDLE_VALUE;
+#else
+				if (data_ != nullptr)
+					::munmap(data_, size_);
+				if (descriptor_ >= 0)
+					::close(descriptor_);
+				descriptor_ = -1;
+#endif
+				data_ = nullptr;
+				size_ = 0u;
+			}
+
+			std::byte* data_{ nullptr };
+			size_t size_{ 0u };
+			bool writable_{ false };
+#if defined(_WIN32)
+			HANDLE handle_{ INVALID_HANDLE_VALUE };
+			HANDLE view_{ nullptr };
+#else
+			int descriptor_{ -1 };
+#endif
+		};
+
+		// typed window of `size` elements at byte `offset` into a shared mapping; copies share the mapping.
+		// T is const-qualified for windows into read-only mappings
+		template<typename T>
+		class region {
+		public:
+			using element_type = T;
+			using value_type = std::remove_cv_t<T>;
+
+			region() = default;
+
+			region(std::shared_ptr<mapping> file, size_t offset, size_t size)
+				: file_(std::move(file)), offset_(offset), size_(size) {}
+
+			size_t size() const noexcept { return size_; }
+			T* data() noexcept { return address(); }
+			const T* data() const noexcept { return address(); }
+			T& operator[](size_t k) noexcept { return address()[k]; }
+			const T& operator[](size_t k) const noexcept { return address()[k]; }
+			T* begin() noexcept { return address(); }
+			T* end() noexcept { return address() + size_; }
+			const T* begin() const noexcept { return address(); }
+			const T* end() const noexcept { return address() + size_; }
+			size_t offset() const noexcept { return offset_; }
+			const std::shared_ptr<mapping>& file() const noexcept { return file_; }
+
+		private:
+			T* address() const noexcept { return file_ ? reinterpret_cast<T*>(file_->data() + offset_) : nullptr; }
+
+			std::shared_ptr<mapping> file_;
+			size_t offset_{ 0u };
+			size_t size_{ 0u };
+		};
+	}
+
+	/***********************************************************************************/
+	/* reduced precision space                                                         */
+	/***********************************************************************************/
+	namespace precision {
+
+		// brain floating point storage: the upper half of a binary32 (8-bit exponent, 7-bit mantissa);
+		// reads as float, rounds to nearest even on narrowing
+		struct bfloat16 {
+			std::uint16_t bits{ 0u };
+
+			bfloat16() = default;
+			template<typename X, typename = std::enable_if_t<!std::is_same_v<X, bfloat16> && std::is_convertible_v<X, float> > >
+			explicit bfloat16(X x) noexcept : bits{ encode(float(x)) } {}
+			operator float() const noexcept { return decode(bits); }
+
+			static std::uint16_t encode(float x) noexcept {
+				std::uint32_t u;
+				std::memcpy(&u, &x, sizeof(u));
+				if ((u & 0x7FFFFFFFu) > 0x7F800000u)
+					return std::uint16_t((u >> 16) | 0x0040u);
+				return std::uint16_t((u + 0x7FFFu + ((u >> 16) & 1u)) >> 16);
+			}
+
+			static float decode(std::uint16_t h) noexcept {
+				std::uint32_t u{ std::uint32_t(h) << 16 };
+				float x;
+				std::memcpy(&x, &u, sizeof(x));
+				return x;
+			}
+		};
+
+		// IEEE-754 binary16 storage (5-bit exponent, 10-bit mantissa, subnormals);
+		// reads as float, rounds to nearest even on narrowing and saturates to infinity
+		struct float16 {
+			std::uint16_t bits{ 0u };
+
+			float16() = default;
+			template<typename X, typename = std::enable_if_t<!std::is_same_v<X, float16> && std::is_convertible_v<X, float> > >
+			explicit float16(X x) noexcept : bits{ encode(float(x)) } {}
+			operator float() const noexcept { return decode(bits); }
+
+			static std::uint16_t encode(float x) noexcept {
+#if defined(__F16C__) && defined(__FLT16_MAX__)
+				// hardware conversion
+				_Float16 h{ static_cast<_Float16>(x) };
+				std::uint16_t bits;
+				std::memcpy(&bits, &h, sizeof(bits));
+				return bits;
+#else
+				std::uint32_t u;
+				std::memcpy(&u, &x, sizeof(u));
+				std::uint32_t sign{ (u >> 16) & 0x8000u };
+				std::uint32_t magnitude{ u & 0x7FFFFFFFu };
+				if (magnitude > 0x7F800000u)
+					return std::uint16_t(sign | 0x7E00u);
+				if (magnitude >= 0x477FF000u)
+					return std::uint16_t(sign | 0x7C00u);
+				if (magnitude < 0x38800000u) {
+					// subnormal: adding 0.5 rounds the magnitude to a multiple of 2^-24 in the float unit
+					float y;
+					std::memcpy(&y, &magnitude, sizeof(y));
+					y += 0.5f;
+					std::memcpy(&magnitude, &y, sizeof(y));
+					return std::uint16_t(sign | (magnitude - 0x3F000000u));
+				}
+				magnitude -= 0x38000000u;
+				return std::uint16_t(sign | ((magnitude + 0x0FFFu + ((magnitude >> 13) & 1u)) >> 13));
+#endif
+			}
+
+			static float decode(std::uint16_t h) noexcept {
+#if defined(__F16C__) && defined(__FLT16_MAX__)
+				_Float16 x;
+				std::memcpy(&x, &h, sizeof(x));
+				return static_cast<float>(x);
+#else
+				std::uint32_t sign{ std::uint32_t(h & 0x8000u) << 16 };
+				std::uint32_t exponent{ (h >> 10) & 0x1Fu };
+				std::uint32_t mantissa{ h & 0x03FFu };
+				if (exponent == 0u) {
+					float y{ float(mantissa) * 5.9604644775390625e-8f };
+					return sign != 0u ? -y : y;
+				}
+				std::uint32_t u{ sign | (exponent == 0x1Fu ? 0x7F800000u | (mantissa << 13) : ((exponent + 112u) << 23) | (mantissa << 13)) };
+				float x;
+				std::memcpy(&x, &u, sizeof(x));
+				return x;
+#endif
+			}
+		};
+
+		// reduced-precision storage trait
+		template<typename T>
+		struct is_reduced : std::false_type {};
+
+		template<>
+		struct is_reduced<bfloat16> : std::true_type {};
+
+		template<>
+		struct is_reduced<float16> : std::true_type {};
+
+		template<typename T>
+		constexpr bool is_reduced_v = is_reduced<std::remove_cv_t<T> >::value;
+
+		// matrix element types: arithmetic types and the reduced-precision storage formats
+		template<typename T>
+		constexpr bool is_element_v = std::is_arithmetic_v<T> || is_reduced_v<T>;
+
+		// type products are accumulated in: binary32 for the 16-bit storage formats, T otherwise
+		template<typename T>
+		using accumulator_t = std::conditional_t<is_reduced_v<T>, float, T>;
+	}
+
+
+	/***********************************************************************************/
+	/* instrumentation space                                                           */
+	/***********************************************************************************/
+	namespace instrumentation {
+
+		// whether instrumented operations record their calls (HPMX_INSTRUMENTATION); when disabled the probes
+		// compile to nothing and snapshots are empty
+#if defined(HPMX_INSTRUMENTATION)
+		constexpr bool enabled = true;
+#else
+		constexpr bool enabled = false;
+#endif
+
+		// size histogram buckets: bucket b counts calls whose result spans [2^b, 2^(b + 1)) elements (bucket 0 also
+		// counts empty results)
+		constexpr size_t size_buckets_ = 48u;
+
+		// counters of one instrumented operation, updated with relaxed atomics
+		struct counters {
+			std::atomic<std::uint64_t> calls{ 0u };
+			std::atomic<std::uint64_t> nanoseconds{ 0u };
+			std::atomic<std::uint64_t> flops{ 0u };
+			std::atomic<std::uint64_t> bytes{ 0u };
+			std::atomic<std::uint64_t> allocations{ 0u };
+			std::atomic<std::uint64_t> allocated_bytes{ 0u };
+			std::array<std::atomic<std::uint64_t>, size_buckets_> sizes{};
+		};
+
+		// process-wide operation registry; counters are created on first use of a name and never move
+		class registry {
+		public:
+			counters& site(std::string_view name) {
+				std::lock_guard<std::mutex> lock{ mutex_ };
+				auto it{ sites_.find(name) };
+				if (it == sites_.end())
+					it = sites_.try_emplace(std::string(name)).first;
+				return it->second;
+			}
+
+			template<typename Fn>
+			void for_each(Fn && fn) {
+				std::lock_guard<std::mutex> lock{ mutex_ };
+				for (auto& [name, site] : sites_)
+					fn(name, site);
+			}
+
+		private:
+			std::mutex mutex_;
+			std::map<std::string, counters, std::less<> > sites_;
+		};
+
+		auto sites = []() -> registry & {
+			static registry instance;
+			return instance;
+		};
+
+		// counters of an operation, by name
+		auto site = [](std::string_view name) -> counters & {
+			return sites().site(name);
+		};
+
+		// innermost measured call of the calling thread, charged with the heap allocations it makes
+		inline thread_local counters* current{ nullptr };
+
+		// measurement of one call: counts it with its result dimensions, flops and compulsory bytes on entry,
+		// and its wall time on exit
+		class scope {
+		public:
+			scope(counters & site, size_t number_of_rows, size_t number_of_columns, std::uint64_t flops, std::uint64_t bytes)
+				: site_{ site }, outer_{ current }, start_{ std::chrono::steady_clock::now() } {
+				auto elements{ std::uint64_t(number_of_rows) * std::uint64_t(number_of_columns) };
+				size_t bucket{ 0u };
+				while (bucket + 1u < size_buckets_ && (elements >> (bucket + 1u)) != 0u)
+					++bucket;
+				site_.calls.fetch_add(1u, std::memory_order_relaxed);
+				site_.flops.fetch_add(flops, std::memory_order_relaxed);
+				site_.bytes.fetch_add(bytes, std::memory_order_relaxed);
+				site_.sizes[bucket].fetch_add(1u, std::memory_order_relaxed);
+				current = &site_;
+			}
+			scope(const scope&) = delete;
+			scope& operator=(const scope&) = delete;
+			~scope() {
+				auto elapsed{ std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count() };
+				site_.nanoseconds.fetch_add(std::uint64_t(elapsed), std::memory_order_relaxed);
+				current = outer_;
+			}
+
+		private:
+			counters& site_;
+			counters* outer_;
+			std::chrono::steady_clock::time_point start_;
+		};
+
+		// charges a heap allocation to the calling thread's innermost measured call
+		inline void allocation(size_t bytes) noexcept {
+			if (current != nullptr) {
+				current->allocations.fetch_add(1u, std::memory_order_relaxed);
+				current->allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+			}
+		}
+
+		// point-in-time copy of the counters of one operation
+		struct record {
+			std::string operation;
+			std::uint64_t calls;
+			std::uint64_t nanoseconds;
+			std::uint64_t flops;
+			std::uint64_t bytes;
+			std::uint64_t allocations;
+			std::uint64_t allocated_bytes;
+			std::array<std::uint64_t, size_buckets_> sizes;
+		};
+
+		// copies of all counters, by operation name
+		auto snapshot = []() {
+			std::vector<record> records;
+			sites().for_each([&records](const std::string & name, const counters & site) {
+				record r{ name, site.calls.load(std::memory_order_relaxed), site.nanoseconds.load(std::memory_order_relaxed),
+					site.flops.load(std::memory_order_relaxed), site.bytes.load(std::memory_order_relaxed),
+					site.allocations.load(std::memory_order_relaxed), site.allocated_bytes.load(std::memory_order_relaxed), {} };
+				for (size_t b{ 0u }; b < size_buckets_; ++b)
+					r.sizes[b] = site.sizes[b].load(std::memory_order_relaxed);
+				records.push_back(std::move(r));
+			});
+			return records;
+		};
+
+		// zeroes all counters (e.g. after each scrape)
+		auto reset = []() {
+			sites().for_each([](const std::string &, counters & site) {
+				for (auto* counter : { &site.calls, &site.nanoseconds, &site.flops, &site.bytes, &site.allocations, &site.allocated_bytes })
+					counter->store(0u, std::memory_order_relaxed);
+				for (auto& bucket : site.sizes)
+					bucket.store(0u, std::memory_order_relaxed);
+			});
+		};
+
+		// machine-readable writers of a snapshot; the size histogram lists its non-empty buckets as log2:count
+		auto write_csv = [](std::ostream & os, const std::vector<record> & records) {
+			os << "operation,calls,nanoseconds,flops,bytes,allocations,allocated_bytes,gflop_per_s,gb_per_s,sizes\n";
+			for (const auto& r : records) {
+				os << r.operation << ',' << r.calls << ',' << r.nanoseconds << ',' << r.flops << ',' << r.bytes << ','
+					<< r.allocations << ',' << r.allocated_bytes << ','
+					<< (r.nanoseconds > 0u ? double(r.flops) / double(r.nanoseconds) : 0.0) << ','
+					<< (r.nanoseconds > 0u ? double(r.bytes) / double(r.nanoseconds) : 0.0) << ',';
+				auto separator{ "" };
+				for (size_t b{ 0u }; b < size_buckets_; ++b)
+					if (r.sizes[b] != 0u) {
+						os << separator << b << ':' << r.sizes[b];
+						separator = " ";
+					}
+				os << '\n';
+			}
+		};
+
+		auto write_json = [](std::ostream & os, const std::vector<record> & records) {
+			os << "{\n  \"operations\": [\n";
+			for (size_t k{ 0u }; k < records.size(); ++k) {
+				const auto& r{ records[k] };
+				os << "    { \"operation\": \"" << r.operation << "\", \"calls\": " << r.calls << ", \"nanoseconds\": " << r.nanoseconds
+					<< ", \"flops\": " << r.flops << ", \"bytes\": " << r.bytes << ", \"allocations\": " << r.allocations
+					<< ", \"allocated_bytes\": " << r.allocated_bytes << ", \"sizes\": {";
+				auto separator{ "" };
+				for (size_t b{ 0u }; b < size_buckets_; ++b)
+					if (r.sizes[b] != 0u) {
+						os << separator << " \"" << b << "\": " << r.sizes[b];
+						separator = ",";
+					}
+				os << " } }" << (k + 1u < records.size() ? ",\n" : "\n");
+			}
+			os << "  ]\n}\n";
+		};
+	}
+
 	/***********************************************************************************/
 	/* real space                                                                      */
 	/***********************************************************************************/
@@ -46,330 +893,4886 @@ namespace hpmx {
 
 				// real-valued matrix data structure
 				template<typename T>
-				using _ = std::enable_if_t<std::is_arithmetic_v<T>, std::tuple<size_t, size_t, std::valarray<T> > >;
+				using _ = std::enable_if_t<precision::is_element_v<T>, std::tuple<size_t, size_t, std::valarray<T> > >;
 
 				// generic matrix protocols
 				constexpr size_t number_of_rows_ = 0u;
 				constexpr size_t number_of_columns_ = 1u;
 				constexpr size_t data_ = 2u;
 
-				// matrix constructor
-				auto constructor = [](size_t number_of_rows, size_t number_of_columns, const auto & data) {
-					using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
-					if constexpr (std::is_arithmetic_v<data_type>) {
-						return std::make_tuple(number_of_rows,
-							number_of_columns,
-							std::valarray<data_type>(data, number_of_rows * number_of_columns));
+				// strided matrix protocols (aligned matrices and views)
+				constexpr size_t row_stride_ = 3u;
+				constexpr size_t column_stride_ = 4u;
+
+				/***********************************************************************/
+				/* real-valued matrix computational kernels space                      */
+				/***********************************************************************/
+				namespace kernel {
+
+					// widest simd register the compiler is allowed to use (in bytes)
+#if defined(__AVX512F__)
+					constexpr size_t simd_width_ = 64u;
+#elif defined(__AVX__)
+					constexpr size_t simd_width_ = 32u;
+#else
+					constexpr size_t simd_width_ = 16u;
+#endif
+
+					// micro-kernel register tile: rows x columns accumulators kept in `width`-byte simd registers
+					template<typename T, size_t width = simd_width_>
+					struct register_tile {
+						static constexpr size_t rows = width == 64u ? 8u : 6u;
+						static constexpr size_t columns = 2u * (width >= sizeof(T) ? width / sizeof(T) : 1u);
+					};
+
+					// native simd vector of T spanning one register, or `width` bytes of it (gcc/clang vector extensions)
+#if defined(__GNUC__)
+					template<typename T, size_t width = simd_width_>
+					struct simd_vector {
+						static constexpr bool supported = (std::is_floating_point_v<T> && sizeof(T) <= 8u) ||
+							(std::is_integral_v<T> && !std::is_same_v<T, bool>);
+						typedef T type __attribute__((vector_size(width), aligned(sizeof(T))));
+					};
+#else
+					template<typename T, size_t width = simd_width_>
+					struct simd_vector {
+						static constexpr bool supported = false;
+					};
+#endif
+
+					// simd register width of the running cpu (in bytes): the build's own, raised once at startup to
+					// 32 (avx2 + fma) or 64 (avx-512) when the cpu supports them; HPMX_ISA=sse, avx2 or avx512 in the
+					// environment caps it (never below the build's own)
+					auto host_simd_width = []() -> size_t {
+						static const size_t width{ []() {
+							size_t detected{ simd_width_ };
+#if defined(HPMX_DISPATCH)
+							__builtin_cpu_init();
+							if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+								__builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl"))
+								detected = std::max<size_t>(detected, 64u);
+							else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+								detected = std::max<size_t>(detected, 32u);
+							if (const char* cap{ std::getenv("HPMX_ISA") }) {
+								std::string_view level{ cap };
+								size_t limit{ level == "sse" ? 16u : level == "avx2" ? 32u : 64u };
+								detected = std::max(simd_width_, std::min(detected, limit));
+							}
+#endif
+							return detected;
+						}() };
+						return width;
+					};
+
+					// instruction set name of a simd width
+					auto isa_name = [](size_t width) -> std::string_view {
+						return width >= 64u ? "avx512" : width >= 32u ? "avx2" : "sse";
+					};
+
+#if defined(HPMX_DISPATCH)
+					// trampolines generating an HPMX_INLINE body with the avx2 + fma or avx-512 instruction sets
+					template<typename Body>
+					__attribute__((target("avx2,fma"))) void on_avx2(Body & body) {
+						body();
 					}
-					else {
-						using data_value_type = typename data_type::value_type;
-						auto retmat{ std::make_tuple(number_of_rows, number_of_columns,
-						std::valarray<data_value_type>(data_value_type(0), number_of_rows * number_of_columns)) };
-						auto minsize{ std::min(std::size(data), std::get<data_>(retmat).size()) };
-						auto it = std::begin(data);
-						for (auto i{ 0u }; i < minsize; ++i) {
-							std::get<data_>(retmat)[i] = *it;
-							it = std::next(it);
-						}
-						return retmat;
+
+					template<typename Body>
+					__attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma"))) void on_avx512(Body & body) {
+						body();
 					}
-				};
+#endif
 
-				// matrix display
-				auto display = [](std::string_view title, const auto& data) {
-					using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
-					using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
-					if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
-						std::cout.right;
-						std::cout << title << " (" << std::get<number_of_rows_>(data) << " x " << std::get<number_of_columns_>(data) << ")\n\n";
-						for (auto i{ 0u }; i < std::get<number_of_rows_>(data); ++i) {
-							for (auto j{ 0u }; j < std::get<number_of_columns_>(data); ++j)
-								std::cout << std::setw(16) << std::get<data_>(data)[i * std::get<number_of_columns_>(data) + j];
-							std::cout << std::endl;
+					// runs an HPMX_INLINE body() generated for the instruction set of `width` (an std::integral_constant;
+					// widths the build already targets need no trampoline)
+					auto simd_target = [](auto width, auto && body) {
+#if defined(HPMX_DISPATCH)
+						if constexpr (decltype(width)::value > simd_width_ && decltype(width)::value == 64u)
+							on_avx512(body);
+						else if constexpr (decltype(width)::value > simd_width_ && decltype(width)::value == 32u)
+							on_avx2(body);
+						else
+							body();
+#else
+						(void)width;
+						body();
+#endif
+					};
+
+					// calls fn(width) with the host simd width as an std::integral_constant
+					auto simd_dispatch = [](auto && fn) {
+#if defined(HPMX_DISPATCH)
+						auto width{ host_simd_width() };
+						if constexpr (simd_width_ < 64u) {
+							if (width == 64u)
+								return fn(std::integral_constant<size_t, 64u>{});
 						}
-					}
-				};
+						if constexpr (simd_width_ < 32u) {
+							if (width == 32u)
+								return fn(std::integral_constant<size_t, 32u>{});
+						}
+#endif
+						return fn(std::integral_constant<size_t, simd_width_>{});
+					};
 
-				/***********************************************************************/
-				/* real-valued matrix space real-valued matrix getters space           */
-				/***********************************************************************/
-				namespace get {
+					// runs an HPMX_INLINE body(width) generated for the host instruction set
+					auto vectorized = [](auto && body) {
+						simd_dispatch([&body](auto width) {
+							simd_target(width, [&body, width]() HPMX_INLINE { body(width); });
+						});
+					};
 
-					/*******************************************************************/
-					/* row getters space                                               */
-					/*******************************************************************/
-					namespace row {
+					// cache blocking of the packed operands (in elements)
+					struct blocking {
+						size_t mc;	// rows of the packed lhs block, kept resident in L2
+						size_t kc;	// depth of the packed micro-panels, kept resident in L1
+						size_t nc;	// columns of the packed rhs block, kept resident in L3
+					};
+
+					// default blocking for typical 32 KiB L1d, 1 MiB L2 and multi-MiB shared L3 caches
+					template<typename T>
+					inline blocking gemm_blocking{
+						(std::max<size_t>((256u * 1024u) / (256u * sizeof(T)), register_tile<T>::rows) / register_tile<T>::rows) * register_tile<T>::rows,
+						256u,
+						(std::max<size_t>((2u * 1024u * 1024u) / (256u * sizeof(T)), register_tile<T>::columns) / register_tile<T>::columns) * register_tile<T>::columns
+					};
+
+					// 64-byte aligned scratch buffer, grown on demand and reused across calls
+					template<typename T>
+					class workspace {
+					public:
+						workspace() = default;
+						workspace(const workspace&) = delete;
+						workspace& operator=(const workspace&) = delete;
+						~workspace() { release(); }
+
+						T* data(size_t n) {
+							if (n > capacity_) {
+								release();
+								buffer_ = static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{ 64u }));
+								capacity_ = n;
+							}
+							return buffer_;
+						}
+
+					private:
+						void release() {
+							if (buffer_ != nullptr)
+								::operator delete(buffer_, std::align_val_t{ 64u });
+							buffer_ = nullptr;
+							capacity_ = 0u;
+						}
+
+						T* buffer_{ nullptr };
+						size_t capacity_{ 0u };
+					};
+
+					// first element address of a valarray (nullptr when empty)
+					auto pointer = [](auto & data) {
+						return data.size() == 0u ? nullptr : &data[0];
+					};
+
+					// packs an mc x kc block of a strided lhs into zero-padded row micro-panels of height MR
+					auto pack_lhs = [](size_t mc, size_t kc, const auto * a, std::ptrdiff_t rs, std::ptrdiff_t cs, auto * buffer, auto width) HPMX_INLINE {
+						using value_type = std::remove_pointer_t<decltype(buffer)>;
+						constexpr size_t mr{ register_tile<value_type, decltype(width)::value>::rows };
+						for (size_t ir{ 0u }; ir < mc; ir += mr) {
+							auto m{ std::min(mr, mc - ir) };
+							const auto* panel{ a + std::ptrdiff_t(ir) * rs };
+							for (size_t p{ 0u }; p < kc; ++p, buffer += mr) {
+								for (size_t i{ 0u }; i < m; ++i)
+									buffer[i] = value_type(panel[std::ptrdiff_t(i) * rs + std::ptrdiff_t(p) * cs]);
+								for (size_t i{ m }; i < mr; ++i)
+									buffer[i] = value_type(0);
+							}
+						}
+					};
+
+					// packs a kc x nc block of a strided rhs into zero-padded column micro-panels of width NR; a
+					// transposed (column-major) rhs is read down its columns, i.e. in its stored layout
+					auto pack_rhs = [](size_t kc, size_t nc, const auto * b, std::ptrdiff_t rs, std::ptrdiff_t cs, auto * buffer, auto width) HPMX_INLINE {
+						using value_type = std::remove_pointer_t<decltype(buffer)>;
+						constexpr size_t nr{ register_tile<value_type, decltype(width)::value>::columns };
+						for (size_t jr{ 0u }; jr < nc; jr += nr) {
+							auto n{ std::min(nr, nc - jr) };
+							const auto* panel{ b + std::ptrdiff_t(jr) * cs };
+							if (rs == 1 && cs != 1) {
+								for (size_t j{ 0u }; j < n; ++j)
+									for (size_t p{ 0u }; p < kc; ++p)
+										buffer[p * nr + j] = value_type(panel[std::ptrdiff_t(p) + std::ptrdiff_t(j) * cs]);
+								for (size_t p{ 0u }; p < kc; ++p, buffer += nr)
+									for (size_t j{ n }; j < nr; ++j)
+										buffer[j] = value_type(0);
+								continue;
+							}
+							for (size_t p{ 0u }; p < kc; ++p, buffer += nr) {
+								for (size_t j{ 0u }; j < n; ++j)
+									buffer[j] = value_type(panel[std::ptrdiff_t(p) * rs + std::ptrdiff_t(j) * cs]);
+								for (size_t j{ n }; j < nr; ++j)
+									buffer[j] = value_type(0);
+							}
+						}
+					};
+
+					// MR x NR register-tiled micro-kernel: c(m x n) = alpha * a_panel * b_panel + beta * c
+					auto micro_kernel = [](size_t kc, const auto * __restrict a, const auto * __restrict b, auto * __restrict c, size_t ldc, size_t m, size_t n, auto alpha, auto beta, auto width) HPMX_INLINE {
+						using value_type = std::remove_reference_t<decltype(*c)>;
+						constexpr size_t mr{ register_tile<value_type, decltype(width)::value>::rows };
+						constexpr size_t nr{ register_tile<value_type, decltype(width)::value>::columns };
+						value_type acc[mr][nr];
+#if defined(__GNUC__)
+						if constexpr (simd_vector<value_type, decltype(width)::value>::supported) {
+							using vector_type = typename simd_vector<value_type, decltype(width)::value>::type;
+							constexpr size_t lanes{ decltype(width)::value / sizeof(value_type) };
+							constexpr size_t nv{ nr / lanes };
+							// packed rhs rows start on register boundaries (64-byte workspace, rows of two registers), so
+							// they are loaded as whole aligned registers
+							typedef value_type panel_type __attribute__((vector_size(decltype(width)::value), may_alias));
+							vector_type vacc[mr][nv]{};
+							for (size_t p{ 0u }; p < kc; ++p, a += mr, b += nr) {
+								vector_type bv[nv];
+#pragma GCC unroll 8
+								for (size_t j{ 0u }; j < nv; ++j)
+									bv[j] = *reinterpret_cast<const panel_type*>(b + j * lanes);
+#pragma GCC unroll 16
+								for (size_t i{ 0u }; i < mr; ++i) {
+									const value_type ai{ a[i] };
+#pragma GCC unroll 8
+									for (size_t j{ 0u }; j < nv; ++j)
+										vacc[i][j] += ai * bv[j];
+								}
+							}
+							std::memcpy(acc, vacc, sizeof(acc));
+						}
+						else
+#endif
+						{
+							for (size_t i{ 0u }; i < mr; ++i)
+								for (size_t j{ 0u }; j < nr; ++j)
+									acc[i][j] = value_type(0);
+							for (size_t p{ 0u }; p < kc; ++p, a += mr, b += nr)
+								for (size_t i{ 0u }; i < mr; ++i)
+									for (size_t j{ 0u }; j < nr; ++j)
+										acc[i][j] += a[i] * b[j];
+						}
+						if (beta == value_type(0)) {
+							for (size_t i{ 0u }; i < m; ++i)
+								for (size_t j{ 0u }; j < n; ++j)
+									c[i * ldc + j] = alpha * acc[i][j];
+						}
+						else {
+							for (size_t i{ 0u }; i < m; ++i)
+								for (size_t j{ 0u }; j < n; ++j)
+									c[i * ldc + j] = alpha * acc[i][j] + beta * c[i * ldc + j];
+						}
+					};
+
+					// general matrix multiply: C(m x n) = alpha * A(m x k) * B(k x n) + beta * C
+					// A and B are addressed through (row, column) strides, C is row-major with leading dimension ldc;
+					// up to `threads` threads share each packed rhs block and split the lhs blocks between them; the
+					// register tile and the packing and micro-kernels follow the host instruction set
+					auto blocked_gemm = [](size_t m, size_t n, size_t k,
+						auto alpha, const auto * a, std::ptrdiff_t rsa, std::ptrdiff_t csa,
+						const auto * b, std::ptrdiff_t rsb, std::ptrdiff_t csb,
+						auto beta, auto * c, size_t ldc, size_t threads) {
+
+						using value_type = std::remove_pointer_t<decltype(c)>;
+
+						if (m == 0u || n == 0u)
+							return;
+						if (k == 0u) {
+							for (size_t i{ 0u }; i < m; ++i)
+								for (size_t j{ 0u }; j < n; ++j)
+									c[i * ldc + j] = beta == value_type(0) ? value_type(0) : value_type(beta * c[i * ldc + j]);
+							return;
+						}
+						if (m * n * k < concurrency::parallel_grain * 64u)
+							threads = 1u;
+
+						simd_dispatch([&](auto width) {
+							constexpr size_t mr{ register_tile<value_type, decltype(width)::value>::rows };
+							constexpr size_t nr{ register_tile<value_type, decltype(width)::value>::columns };
+
+							// blocks rounded to whole register tiles of this instruction set
+							auto blocks{ gemm_blocking<value_type> };
+							auto mc{ std::max(mr, blocks.mc / mr * mr) };
+							auto kc{ std::max<size_t>(blocks.kc, 1u) };
+							auto nc{ std::max(nr, blocks.nc / nr * nr) };
+							auto mcur_max{ threads > 1u ? std::min(mc, ((m + threads * mr - 1u) / (threads * mr)) * mr) : mc };
+							thread_local workspace<value_type> rhs_workspace;
+							auto* packed_rhs{ rhs_workspace.data(kc * nc) };
+
+							for (size_t jc{ 0u }; jc < n; jc += nc) {
+								auto ncur{ std::min(nc, n - jc) };
+								auto panels{ (ncur + nr - 1u) / nr };
+								for (size_t pc{ 0u }; pc < k; pc += kc) {
+									auto kcur{ std::min(kc, k - pc) };
+									auto bcur{ pc == 0u ? value_type(beta) : value_type(1) };
+									const auto* bblock{ b + std::ptrdiff_t(pc) * rsb + std::ptrdiff_t(jc) * csb };
+									concurrency::parallel_for(0u, panels, 4u, threads, [&](size_t first, size_t last) {
+										simd_target(width, [&]() HPMX_INLINE {
+											pack_rhs(kcur, std::min(ncur, last * nr) - first * nr, bblock + std::ptrdiff_t(first * nr) * csb, rsb, csb,
+												packed_rhs + first * nr * kcur, width);
+										});
+									});
+									concurrency::parallel_for(0u, (m + mcur_max - 1u) / mcur_max, 1u, threads, [&](size_t first, size_t last) {
+										thread_local workspace<value_type> lhs_workspace;
+										auto* packed_lhs{ lhs_workspace.data(mc * kc) };
+										simd_target(width, [&]() HPMX_INLINE {
+											for (auto block{ first }; block < last; ++block) {
+												auto ic{ block * mcur_max };
+												auto mcur{ std::min(mcur_max, m - ic) };
+												pack_lhs(mcur, kcur, a + std::ptrdiff_t(ic) * rsa + std::ptrdiff_t(pc) * csa, rsa, csa, packed_lhs, width);
+												for (size_t jr{ 0u }; jr < ncur; jr += nr)
+													for (size_t ir{ 0u }; ir < mcur; ir += mr)
+														micro_kernel(kcur,
+															packed_lhs + ir * kcur,
+															packed_rhs + jr * kcur,
+															c + (ic + ir) * ldc + jc + jr,
+															ldc,
+															std::min(mr, mcur - ir),
+															std::min(nr, ncur - jr),
+															value_type(alpha),
+															bcur,
+															width);
+											}
+										});
+									});
+								}
+							}
+						});
+					};
+
+					// strided elementwise map: c(i, j) = fn(a(i, j)) into a row-major result with leading dimension ldc
+					auto map = [](size_t m, size_t n, size_t threads, auto * c, size_t ldc, const auto * a, std::ptrdiff_t rsa, std::ptrdiff_t csa, auto && fn) {
+						if (ldc == n && csa == 1 && rsa == std::ptrdiff_t(n))
+							concurrency::parallel_for(0u, m * n, concurrency::parallel_grain, threads, [c, a, &fn](size_t first, size_t last) {
+								vectorized([&](auto) HPMX_INLINE {
+									for (auto k{ first }; k < last; ++k)
+										c[k] = fn(a[k]);
+								});
+							});
+						else
+							concurrency::parallel_for(0u, m, std::max<size_t>(concurrency::parallel_grain / std::max<size_t>(n, 1u), 1u), threads,
+								[=, &fn](size_t first, size_t last) {
+									for (auto i{ first }; i < last; ++i)
+										for (size_t j{ 0u }; j < n; ++j)
+											c[i * ldc + j] = fn(a[std::ptrdiff_t(i) * rsa + std::ptrdiff_t(j) * csa]);
+								});
+					};
+
+					// strided elementwise zip: c(i, j) = fn(a(i, j), b(i, j)) into a row-major result with leading dimension ldc
+					auto zip = [](size_t m, size_t n, size_t threads, auto * c, size_t ldc,
+						const auto * a, std::ptrdiff_t rsa, std::ptrdiff_t csa,
+						const auto * b, std::ptrdiff_t rsb, std::ptrdiff_t csb, auto && fn) {
+						if (ldc == n && csa == 1 && rsa == std::ptrdiff_t(n) && csb == 1 && rsb == std::ptrdiff_t(n))
+							concurrency::parallel_for(0u, m * n, concurrency::parallel_grain, threads, [c, a, b, &fn](size_t first, size_t last) {
+								vectorized([&](auto) HPMX_INLINE {
+									for (auto k{ first }; k < last; ++k)
+										c[k] = fn(a[k], b[k]);
+								});
+							});
+						else
+							concurrency::parallel_for(0u, m, std::max<size_t>(concurrency::parallel_grain / std::max<size_t>(n, 1u), 1u), threads,
+								[=, &fn](size_t first, size_t last) {
+									for (auto i{ first }; i < last; ++i)
+										for (size_t j{ 0u }; j < n; ++j)
+											c[i * ldc + j] = fn(a[std::ptrdiff_t(i) * rsa + std::ptrdiff_t(j) * csa],
+												b[std::ptrdiff_t(i) * rsb + std::ptrdiff_t(j) * csb]);
+								});
+					};
+
+					// general matrix multiply: C(m x n) = alpha * A(m x k) * B(k x n) + beta * C (see blocked_gemm);
+					// reduced-precision operands are widened while packing, and reduced-precision results accumulate
+					// over the full depth in binary32 scratch and are narrowed once
+					auto gemm = [](size_t m, size_t n, size_t k,
+						auto alpha, const auto * a, std::ptrdiff_t rsa, std::ptrdiff_t csa,
+						const auto * b, std::ptrdiff_t rsb, std::ptrdiff_t csb,
+						auto beta, auto * c, size_t ldc, size_t threads) {
+						using result_type = std::remove_pointer_t<decltype(c)>;
+						if constexpr (precision::is_reduced_v<result_type>) {
+							using value_type = precision::accumulator_t<result_type>;
+							thread_local workspace<value_type> result_workspace;
+							auto* wide{ result_workspace.data(m * n) };
+							if (!(value_type(beta) == value_type(0)))
+								map(m, n, threads, wide, n, c, std::ptrdiff_t(ldc), 1, [](result_type x) { return value_type(x); });
+							blocked_gemm(m, n, k, value_type(alpha), a, rsa, csa, b, rsb, csb, value_type(beta), wide, n, threads);
+							map(m, n, threads, c, ldc, wide, std::ptrdiff_t(n), 1, [](value_type x) { return result_type(x); });
+						}
+						else
+							blocked_gemm(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, ldc, threads);
+					};
+
+					// philox4x32-10 counter-based generator: four random words of a 64-bit counter under a 64-bit key
+					auto philox = [](std::uint64_t counter, std::uint64_t key) {
+						std::array<std::uint32_t, 4u> x{ std::uint32_t(counter), std::uint32_t(counter >> 32), 0u, 0u };
+						std::uint32_t k0{ std::uint32_t(key) };
+						std::uint32_t k1{ std::uint32_t(key >> 32) };
+						for (size_t round{ 0u }; round < 10u; ++round) {
+							auto p0{ std::uint64_t(0xD2511F53u) * x[0] };
+							auto p1{ std::uint64_t(0xCD9E8D57u) * x[2] };
+							x = { std::uint32_t(p1 >> 32) ^ x[1] ^ k0, std::uint32_t(p1), std::uint32_t(p0 >> 32) ^ x[3] ^ k1, std::uint32_t(p0) };
+							k0 += 0x9E3779B9u;
+							k1 += 0xBB67AE85u;
+						}
+						return x;
+					};
+
+					// lane-parallel sum of fn(j) over j in [0, n): independent lane partial sums fill simd registers
+					// without reassociating the sum and are folded pairwise; compensated sums carry a kahan correction
+					// per lane and fold the lanes with one
+					auto accumulate = [](size_t n, auto zero, bool compensated, auto && fn) {
+						using sum_type = decltype(zero);
+						constexpr size_t lanes{ std::max<size_t>(2u * simd_width_ / sizeof(sum_type), 2u) };
+						sum_type sum[lanes];
+						sum_type carry[lanes];
+						for (size_t l{ 0u }; l < lanes; ++l) {
+							sum[l] = zero;
+							carry[l] = zero;
+						}
+						auto m{ n - n % lanes };
+						if constexpr (std::is_floating_point_v<sum_type>) {
+							if (compensated) {
+								auto add = [&sum, &carry](size_t l, sum_type x) {
+									auto y{ x - carry[l] };
+									auto t{ sum[l] + y };
+									carry[l] = (t - sum[l]) - y;
+									sum[l] = t;
+								};
+								for (size_t j{ 0u }; j < m; j += lanes)
+									for (size_t l{ 0u }; l < lanes; ++l)
+										add(l, sum_type(fn(j + l)));
+								for (auto j{ m }; j < n; ++j)
+									add(j - m, sum_type(fn(j)));
+								for (size_t l{ 1u }; l < lanes; ++l) {
+									add(0u, sum[l]);
+									add(0u, -carry[l]);
+								}
+								return sum_type(sum[0] - carry[0]);
+							}
+						}
+						for (size_t j{ 0u }; j < m; j += lanes)
+							for (size_t l{ 0u }; l < lanes; ++l)
+								sum[l] += sum_type(fn(j + l));
+						for (auto j{ m }; j < n; ++j)
+							sum[j - m] += sum_type(fn(j));
+						for (auto width{ lanes / 2u }; width > 0u; width /= 2u)
+							for (size_t l{ 0u }; l < width; ++l)
+								sum[l] += sum[l + width];
+						return sum[0];
+					};
+
+					// lane-parallel extremum of fn(j) over j in [0, n), n > 0: x replaces y when better(x, y)
+					auto extremum = [](size_t n, auto && fn, auto && better) {
+						using value_type = std::remove_cv_t<std::remove_reference_t<decltype(fn(size_t(0u)))> >;
+						constexpr size_t lanes{ std::max<size_t>(2u * simd_width_ / sizeof(value_type), 2u) };
+						value_type best[lanes];
+						for (size_t l{ 0u }; l < lanes; ++l)
+							best[l] = fn(0u);
+						auto m{ n - n % lanes };
+						for (size_t j{ 0u }; j < m; j += lanes)
+							for (size_t l{ 0u }; l < lanes; ++l) {
+								value_type x{ fn(j + l) };
+								best[l] = better(x, best[l]) ? x : best[l];
+							}
+						for (auto j{ m }; j < n; ++j) {
+							value_type x{ fn(j) };
+							best[0] = better(x, best[0]) ? x : best[0];
+						}
+						for (size_t l{ 1u }; l < lanes; ++l)
+							best[0] = better(best[l], best[0]) ? best[l] : best[0];
+						return best[0];
+					};
+
+					// calls body(fn) with fn(j) = p[j * stride], specialized for unit strides, which vectorize
+					auto with_stride = [](const auto * p, std::ptrdiff_t stride, auto && body) {
+						if (stride == 1)
+							return body([p](size_t j) -> decltype(auto) { return p[j]; });
+						return body([p, stride](size_t j) -> decltype(auto) { return p[std::ptrdiff_t(j) * stride]; });
+					};
+
+					// strided fill of `count` elements
+					auto fill = [](auto * first, size_t count, std::ptrdiff_t stride, auto value) {
+						for (size_t k{ 0u }; k < count; ++k)
+							first[std::ptrdiff_t(k) * stride] = value;
+					};
+
+					// edge of the square tiles the cache-oblivious transposes bottom out at (two tiles fit in L1)
+					constexpr size_t transpose_tile_ = 32u;
+
+					// cache-oblivious out-of-place transpose: c(j, i) = a(i, j) for an m x n strided a into a row-major
+					// c with leading dimension ldc; the longer side is halved until both sides fit in a tile, and
+					// strips of transpose_tile_ rows of a are shared between up to `threads` threads
+					auto transpose = [](size_t m, size_t n, size_t threads, auto * c, size_t ldc, const auto * a, std::ptrdiff_t rsa, std::ptrdiff_t csa) {
+						using value_type = std::remove_pointer_t<decltype(c)>;
+						auto recurse = [=](auto & self, size_t i0, size_t i1, size_t j0, size_t j1) -> void {
+							if (i1 - i0 <= transpose_tile_ && j1 - j0 <= transpose_tile_) {
+								// every row of c is written contiguously while the tile of a stays in L1; staging through a
+								// local tile measured slower at every size, power-of-two leading dimensions included
+								for (auto j{ j0 }; j < j1; ++j) {
+									auto* out{ c + j * ldc };
+									const auto* in{ a + std::ptrdiff_t(j) * csa };
+									for (auto i{ i0 }; i < i1; ++i)
+										out[i] = value_type(in[std::ptrdiff_t(i) * rsa]);
+								}
+							}
+							else if (i1 - i0 >= j1 - j0) {
+								auto mid{ i0 + (i1 - i0) / 2u };
+								self(self, i0, mid, j0, j1);
+								self(self, mid, i1, j0, j1);
+							}
+							else {
+								auto mid{ j0 + (j1 - j0) / 2u };
+								self(self, i0, i1, j0, mid);
+								self(self, i0, i1, mid, j1);
+							}
+						};
+						auto strips{ (m + transpose_tile_ - 1u) / transpose_tile_ };
+						concurrency::parallel_for(0u, strips, std::max<size_t>(concurrency::parallel_grain / (transpose_tile_ * std::max<size_t>(n, 1u)), 1u), threads,
+							[&recurse, m, n](size_t first, size_t last) {
+								recurse(recurse, first * transpose_tile_, std::min(m, last * transpose_tile_), 0u, n);
+							});
+					};
+
+					// cache-oblivious in-place transpose of an n x n strided a: strip s of transpose_tile_ rows
+					// transposes its diagonal block and swaps its sub-diagonal part with the matching columns,
+					// so the strips are disjoint and shared between up to `threads` threads
+					auto transpose_square = [](size_t n, size_t threads, auto * a, std::ptrdiff_t rsa, std::ptrdiff_t csa) {
+						auto at = [=](size_t i, size_t j) -> auto & { return a[std::ptrdiff_t(i) * rsa + std::ptrdiff_t(j) * csa]; };
+						// swaps a(i, j) and a(j, i) over [i0, i1) x [j0, j1), a block strictly below the diagonal
+						auto swap_blocks = [&at](auto & self, size_t i0, size_t i1, size_t j0, size_t j1) -> void {
+							if (i1 - i0 <= transpose_tile_ && j1 - j0 <= transpose_tile_) {
+								for (auto i{ i0 }; i < i1; ++i)
+									for (auto j{ j0 }; j < j1; ++j)
+										std::swap(at(i, j), at(j, i));
+							}
+							else if (i1 - i0 >= j1 - j0) {
+								auto mid{ i0 + (i1 - i0) / 2u };
+								self(self, i0, mid, j0, j1);
+								self(self, mid, i1, j0, j1);
+							}
+							else {
+								auto mid{ j0 + (j1 - j0) / 2u };
+								self(self, i0, i1, j0, mid);
+								self(self, i0, i1, mid, j1);
+							}
+						};
+						auto strips{ (n + transpose_tile_ - 1u) / transpose_tile_ };
+						concurrency::parallel_for(0u, strips, 1u, n * n < concurrency::parallel_grain ? size_t(1u) : threads,
+							[&at, &swap_blocks, n](size_t first, size_t last) {
+								for (auto strip{ first }; strip < last; ++strip) {
+									auto i0{ strip * transpose_tile_ };
+									auto i1{ std::min(n, i0 + transpose_tile_) };
+									for (auto i{ i0 }; i < i1; ++i)
+										for (auto j{ i0 }; j < i; ++j)
+											std::swap(at(i, j), at(j, i));
+									if (i0 > 0u)
+										swap_blocks(swap_blocks, i0, i1, 0u, i0);
+								}
+							});
+					};
+
+					// batch entries multiplied together by batched_gemm: one per simd lane
+					template<typename T>
+					constexpr size_t batch_lanes_ = simd_width_ >= sizeof(T) ? simd_width_ / sizeof(T) : 1u;
+
+					// product of batch_lanes_ interleaved small matrices: element e of entry l is stored at e * lanes + l,
+					// so every scalar operation of c(m x n) = a(m x k) * b(k x n) becomes one simd operation across the
+					// group; b is read up to three elements past its end, which the caller pads
+					auto interleaved_gemm = [](size_t m, size_t n, size_t k, const auto * __restrict a, const auto * __restrict b, auto * __restrict c) {
+						using value_type = std::remove_reference_t<decltype(*c)>;
+						constexpr size_t lanes{ batch_lanes_<value_type> };
+						constexpr size_t jr{ 4u };
+#if defined(__GNUC__)
+						if constexpr (simd_vector<value_type>::supported && lanes * sizeof(value_type) == simd_width_) {
+							using vector_type = typename simd_vector<value_type>::type;
+							for (size_t i{ 0u }; i < m; ++i)
+								for (size_t j{ 0u }; j < n; j += jr) {
+									vector_type acc[jr]{};
+									for (size_t p{ 0u }; p < k; ++p) {
+										vector_type av;
+										std::memcpy(&av, a + (i * k + p) * lanes, sizeof(vector_type));
+#pragma GCC unroll 4
+										for (size_t r{ 0u }; r < jr; ++r) {
+											vector_type bv;
+											std::memcpy(&bv, b + (p * n + j + r) * lanes, sizeof(vector_type));
+											acc[r] += av * bv;
+										}
+									}
+									for (size_t r{ 0u }; r < std::min(jr, n - j); ++r)
+										std::memcpy(c + (i * n + j + r) * lanes, &acc[r], sizeof(vector_type));
+								}
+						}
+						else
+#endif
+						{
+							for (size_t i{ 0u }; i < m; ++i)
+								for (size_t j{ 0u }; j < n; ++j) {
+									value_type acc[lanes]{};
+									for (size_t p{ 0u }; p < k; ++p)
+										for (size_t l{ 0u }; l < lanes; ++l)
+											acc[l] += a[(i * k + p) * lanes + l] * b[(p * n + j) * lanes + l];
+									std::copy_n(acc, lanes, c + (i * n + j) * lanes);
+								}
+						}
+					};
+
+					// one small row-major product c(m x n) = a(m x k) * b(k x n) walking the rows of b and c in simd vectors
+					// of `width` bytes: four rows of c accumulate in registers while every row of b is broadcast into them
+					auto row_gemm = [](auto width, size_t m, size_t n, size_t k, const auto * __restrict a, const auto * __restrict b, auto * __restrict c) {
+						using value_type = std::remove_reference_t<decltype(*c)>;
+						constexpr size_t mr{ 4u };
+						size_t j0{ 0u };
+#if defined(__GNUC__)
+						if constexpr (simd_vector<value_type, decltype(width)::value>::supported) {
+							using vector_type = typename simd_vector<value_type, decltype(width)::value>::type;
+							constexpr size_t w{ sizeof(vector_type) / sizeof(value_type) };
+							for (; j0 + w <= n; j0 += w)
+								for (size_t i{ 0u }; i < m; i += mr) {
+									const value_type* rows[mr];
+									for (size_t r{ 0u }; r < mr; ++r)
+										rows[r] = a + std::min(i + r, m - 1u) * k;
+									vector_type acc[mr]{};
+									for (size_t p{ 0u }; p < k; ++p) {
+										vector_type bv;
+										std::memcpy(&bv, b + p * n + j0, sizeof(vector_type));
+#pragma GCC unroll 4
+										for (size_t r{ 0u }; r < mr; ++r)
+											acc[r] += rows[r][p] * bv;
+									}
+									for (size_t r{ 0u }; r < std::min(mr, m - i); ++r)
+										std::memcpy(c + (i + r) * n + j0, &acc[r], sizeof(vector_type));
+								}
+						}
+#endif
+						for (size_t i{ 0u }; i < m; ++i)
+							for (auto j{ j0 }; j < n; ++j) {
+								value_type acc{ 0 };
+								for (size_t p{ 0u }; p < k; ++p)
+									acc += a[i * k + p] * b[p * n + j];
+								c[i * n + j] = acc;
+							}
+					};
+
+					// batched small-matrix multiply: C_l(m x n) = A_l(m x k) * B_l(k x n) for every l < count; each entry
+					// is row-major and consecutive entries are sa, sb and sc elements apart. Rows at least 16 bytes wide
+					// are vectorized within each entry (row_gemm); narrower products are vectorized across the batch,
+					// batch_lanes_ entries at a time interleaved into a thread-local workspace (interleaved_gemm).
+					// Entries or groups are shared between up to `threads` threads
+					auto batched_gemm = [](size_t count, size_t m, size_t n, size_t k,
+						const auto * a, std::ptrdiff_t sa, const auto * b, std::ptrdiff_t sb, auto * c, std::ptrdiff_t sc, size_t threads) {
+
+						using value_type = std::remove_pointer_t<decltype(c)>;
+						constexpr size_t lanes{ batch_lanes_<value_type> };
+						constexpr bool uniform{ std::is_same_v<std::remove_cv_t<std::remove_pointer_t<decltype(a)> >, value_type> &&
+							std::is_same_v<std::remove_cv_t<std::remove_pointer_t<decltype(b)> >, value_type> };
+
+						if (count == 0u || m == 0u || n == 0u)
+							return;
+						auto work{ m * n * std::max<size_t>(k, 1u) };
+
+						auto per_entry = [=](auto width) {
+							concurrency::parallel_for(0u, count, std::max<size_t>(concurrency::parallel_grain / work, 1u), threads, [=](size_t first, size_t last) {
+								for (auto l{ first }; l < last; ++l)
+									row_gemm(width, m, n, k, a + std::ptrdiff_t(l) * sa, b + std::ptrdiff_t(l) * sb, c + std::ptrdiff_t(l) * sc);
+							});
+						};
+
+						if constexpr (uniform) {
+							if (n * sizeof(value_type) >= simd_width_)
+								return per_entry(std::integral_constant<size_t, simd_width_>{});
+							if (n * sizeof(value_type) >= 32u && simd_width_ > 32u)
+								return per_entry(std::integral_constant<size_t, 32u>{});
+							if (n * sizeof(value_type) >= 16u && simd_width_ > 16u)
+								return per_entry(std::integral_constant<size_t, 16u>{});
+						}
+
+						auto groups{ (count + lanes - 1u) / lanes };
+						concurrency::parallel_for(0u, groups, std::max<size_t>(concurrency::parallel_grain / (lanes * work), 1u), threads, [=](size_t first, size_t last) {
+							thread_local workspace<value_type> batch_workspace;
+							auto* pa{ batch_workspace.data((m * k + k * n + 4u + m * n) * lanes) };
+							auto* pb{ pa + m * k * lanes };
+							auto* pc{ pb + (k * n + 4u) * lanes };
+							std::fill_n(pb + k * n * lanes, 4u * lanes, value_type(0));
+							for (auto group{ first }; group < last; ++group) {
+								auto l0{ group * lanes };
+								auto width{ std::min(lanes, count - l0) };
+								if (width < lanes) {
+									std::fill_n(pa, m * k * lanes, value_type(0));
+									std::fill_n(pb, k * n * lanes, value_type(0));
+								}
+								// interleaving is a transpose of the (width x elements) group into (elements x lanes)
+								transpose(width, m * k, 1u, pa, lanes, a + std::ptrdiff_t(l0) * sa, sa, std::ptrdiff_t(1));
+								transpose(width, k * n, 1u, pb, lanes, b + std::ptrdiff_t(l0) * sb, sb, std::ptrdiff_t(1));
+								interleaved_gemm(m, n, k, pa, pb, pc);
+								transpose(m * n, width, 1u, c + std::ptrdiff_t(l0) * sc, size_t(sc), pc, std::ptrdiff_t(lanes), std::ptrdiff_t(1));
+							}
+						});
+					};
+
+					// block size of the blocked factorizations and triangular solves (rows/columns per panel)
+					constexpr size_t factorization_block_ = 64u;
+
+					// blocked triangular solve T X = B in place of a row-major n x r b (leading dimension ldb), for a lower
+					// or upper triangular n x n t addressed through (row, column) strides, optionally with a unit diagonal;
+					// diagonal blocks are solved by substitution and the off-diagonal blocks applied by gemm, and column
+					// strips of b are shared between up to `threads` threads
+					auto trsm = [](bool upper, bool unit, size_t n, size_t r, const auto * t, std::ptrdiff_t rst, std::ptrdiff_t cst, auto * b, size_t ldb, size_t threads) {
+						using value_type = std::remove_pointer_t<decltype(b)>;
+						constexpr size_t nb{ factorization_block_ };
+						auto at = [=](size_t i, size_t j) { return value_type(t[std::ptrdiff_t(i) * rst + std::ptrdiff_t(j) * cst]); };
+
+						// x(i) -= t(i, p) * x(p) for p in [p0, p1), then x(i) /= t(i, i)
+						auto substitute = [=](size_t i, size_t p0, size_t p1, size_t c0, size_t w) {
+							auto* x{ b + i * ldb + c0 };
+							for (auto p{ p0 }; p < p1; ++p) {
+								auto l{ at(i, p) };
+								const auto* y{ b + p * ldb + c0 };
+								for (size_t c{ 0u }; c < w; ++c)
+									x[c] -= l * y[c];
+							}
+							if (!unit) {
+								auto d{ at(i, i) };
+								for (size_t c{ 0u }; c < w; ++c)
+									x[c] /= d;
+							}
+						};
+
+						auto strip = [=](size_t c0, size_t c1) {
+							auto w{ c1 - c0 };
+							if (!upper)
+								for (size_t i0{ 0u }; i0 < n; i0 += nb) {
+									auto i1{ std::min(n, i0 + nb) };
+									for (auto i{ i0 }; i < i1; ++i)
+										substitute(i, i0, i, c0, w);
+									if (i1 < n)
+										gemm(n - i1, w, i1 - i0, value_type(-1), t + std::ptrdiff_t(i1) * rst + std::ptrdiff_t(i0) * cst, rst, cst,
+											b + i0 * ldb + c0, std::ptrdiff_t(ldb), std::ptrdiff_t(1), value_type(1), b + i1 * ldb + c0, ldb, 1u);
+								}
+							else
+								for (auto i1{ n }; i1 > 0u;) {
+									auto i0{ i1 > nb ? i1 - nb : size_t(0u) };
+									for (auto i{ i1 }; i-- > i0;)
+										substitute(i, i + 1u, i1, c0, w);
+									if (i0 > 0u)
+										gemm(i0, w, i1 - i0, value_type(-1), t + std::ptrdiff_t(i0) * cst, rst, cst,
+											b + i0 * ldb + c0, std::ptrdiff_t(ldb), std::ptrdiff_t(1), value_type(1), b + c0, ldb, 1u);
+									i1 = i0;
+								}
+						};
+
+						if (n * n * r < concurrency::parallel_grain * 64u)
+							threads = 1u;
+						concurrency::parallel_for(0u, r, std::max<size_t>(64u, (r + threads - 1u) / threads), threads, strip);
+					};
+
+					// blocked right-looking LU factorization with partial pivoting of a row-major n x n a (leading dimension
+					// lda), in place: P a = L U with the unit lower L and the upper U packed into a, and row i exchanged with
+					// row pivots[i] at step i; each panel is factored column by column, the block row of U by trsm and the
+					// trailing matrix updated by gemm. Returns false when a pivot is zero (singular matrix)
+					auto getrf = [](size_t n, auto * a, size_t lda, size_t * pivots, size_t threads) {
+						using value_type = std::remove_pointer_t<decltype(a)>;
+						constexpr size_t nb{ factorization_block_ };
+						for (size_t j0{ 0u }; j0 < n; j0 += nb) {
+							auto j1{ std::min(n, j0 + nb) };
+							for (auto j{ j0 }; j < j1; ++j) {
+								auto p{ j };
+								for (auto i{ j + 1u }; i < n; ++i)
+									if (std::abs(a[i * lda + j]) > std::abs(a[p * lda + j]))
+										p = i;
+								pivots[j] = p;
+								if (a[p * lda + j] == value_type(0))
+									return false;
+								if (p != j)
+									std::swap_ranges(a + j * lda, a + j * lda + n, a + p * lda);
+								const auto* u{ a + j * lda };
+								auto width{ j1 - j };
+								concurrency::parallel_for(j + 1u, n, std::max<size_t>(concurrency::parallel_grain / width, 1u),
+									(n - j) * width < concurrency::parallel_grain ? size_t(1u) : threads, [=](size_t first, size_t last) {
+										for (auto i{ first }; i < last; ++i) {
+											auto* row{ a + i * lda };
+											auto l{ row[j] /= u[j] };
+											for (auto c{ j + 1u }; c < j1; ++c)
+												row[c] -= l * u[c];
+										}
+									});
+							}
+							if (j1 < n) {
+								trsm(false, true, j1 - j0, n - j1, a + j0 * lda + j0, std::ptrdiff_t(lda), std::ptrdiff_t(1), a + j0 * lda + j1, lda, threads);
+								gemm(n - j1, n - j1, j1 - j0, value_type(-1), a + j1 * lda + j0, std::ptrdiff_t(lda), std::ptrdiff_t(1),
+									a + j0 * lda + j1, std::ptrdiff_t(lda), std::ptrdiff_t(1), value_type(1), a + j1 * lda + j1, lda, threads);
+							}
+						}
+						return true;
+					};
+
+					// blocked right-looking Cholesky factorization a = L L^T of a symmetric positive definite row-major n x n
+					// a (leading dimension lda), in place: L overwrites the lower triangle and the strict upper triangle is
+					// zeroed; the panel below each diagonal block is solved row by row and the trailing lower triangle is
+					// updated by one gemm per block row. Only the lower triangle of a is read. Returns false when a is not
+					// positive definite
+					auto potrf = [](size_t n, auto * a, size_t lda, size_t threads) {
+						using value_type = std::remove_pointer_t<decltype(a)>;
+						constexpr size_t nb{ factorization_block_ };
+
+						// a(i, j) = (a(i, j) - sum_{p in [j0, j)} a(i, p) a(j, p)) / a(j, j) for j in [j0, j1)
+						auto solve_row = [=](size_t i, size_t j0, size_t j1) {
+							auto* x{ a + i * lda };
+							for (auto j{ j0 }; j < j1; ++j) {
+								const auto* y{ a + j * lda };
+								auto s{ x[j] };
+								for (auto p{ j0 }; p < j; ++p)
+									s -= x[p] * y[p];
+								x[j] = s / y[j];
+							}
+						};
+
+						for (size_t j0{ 0u }; j0 < n; j0 += nb) {
+							auto j1{ std::min(n, j0 + nb) };
+							for (auto j{ j0 }; j < j1; ++j) {
+								auto* y{ a + j * lda };
+								solve_row(j, j0, j);
+								auto d{ y[j] };
+								for (auto p{ j0 }; p < j; ++p)
+									d -= y[p] * y[p];
+								if (!(d > value_type(0)))
+									return false;
+								y[j] = std::sqrt(d);
+							}
+							if (j1 == n)
+								break;
+							auto parallel{ (n - j1) * (n - j1) * (j1 - j0) < concurrency::parallel_grain * 64u ? size_t(1u) : threads };
+							concurrency::parallel_for(j1, n, std::max<size_t>(concurrency::parallel_grain / ((j1 - j0) * (j1 - j0)), 1u), parallel,
+								[=](size_t first, size_t last) {
+									for (auto i{ first }; i < last; ++i)
+										solve_row(i, j0, j1);
+								});
+							concurrency::parallel_for(0u, (n - j1 + nb - 1u) / nb, 1u, parallel, [=](size_t first, size_t last) {
+								for (auto block{ first }; block < last; ++block) {
+									auto r0{ j1 + block * nb };
+									auto r1{ std::min(n, r0 + nb) };
+									gemm(r1 - r0, r1 - j1, j1 - j0, value_type(-1), a + r0 * lda + j0, std::ptrdiff_t(lda), std::ptrdiff_t(1),
+										a + j1 * lda + j0, std::ptrdiff_t(1), std::ptrdiff_t(lda), value_type(1), a + r0 * lda + j1, lda, 1u);
+								}
+							});
+						}
+						for (size_t i{ 0u }; i < n; ++i)
+							std::fill(a + i * lda + i + 1u, a + i * lda + n, value_type(0));
+						return true;
+					};
+				}
+
+				// dense operand traits: value type, first element, (row, column) strides and integrity of every
+				// dense representation (valarray-backed matrix, aligned matrix, mapped matrix, strided view)
+				template<typename X>
+				struct dense_traits {
+					static constexpr bool is_dense = false;
+				};
+
+				template<typename T>
+				struct dense_traits<std::tuple<size_t, size_t, std::valarray<T> > > {
+					static constexpr bool is_dense = precision::is_element_v<T>;
+					using value_type = T;
+					template<typename X> static auto pointer(X & x) { return kernel::pointer(std::get<data_>(x)); }
+					template<typename X> static std::ptrdiff_t row_stride(const X & x) { return std::ptrdiff_t(std::get<number_of_columns_>(x)); }
+					template<typename X> static std::ptrdiff_t column_stride(const X &) { return 1; }
+					template<typename X> static bool integrity(const X & x) {
+						return std::get<number_of_rows_>(x) * std::get<number_of_columns_>(x) == std::get<data_>(x).size();
+					}
+				};
+
+				template<typename T>
+				struct dense_traits<std::tuple<size_t, size_t, memory::buffer<T>, size_t> > {
+					static constexpr bool is_dense = std::is_arithmetic_v<T>;
+					using value_type = T;
+					template<typename X> static auto pointer(X & x) { return std::get<data_>(x).data(); }
+					template<typename X> static std::ptrdiff_t row_stride(const X & x) { return std::ptrdiff_t(std::get<row_stride_>(x)); }
+					template<typename X> static std::ptrdiff_t column_stride(const X &) { return 1; }
+					template<typename X> static bool integrity(const X & x) {
+						return std::get<row_stride_>(x) >= std::get<number_of_columns_>(x) &&
+							std::get<number_of_rows_>(x) * std::get<row_stride_>(x) == std::get<data_>(x).size();
+					}
+				};
+
+				template<typename T>
+				struct dense_traits<std::tuple<size_t, size_t, memory::region<T>, size_t> >
+					: dense_traits<std::tuple<size_t, size_t, memory::buffer<std::remove_const_t<T> >, size_t> > {};
+
+				template<typename T>
+				struct dense_traits<std::tuple<size_t, size_t, T*, std::ptrdiff_t, std::ptrdiff_t> > {
+					static constexpr bool is_dense = precision::is_element_v<std::remove_const_t<T> >;
+					using value_type = std::remove_const_t<T>;
+					template<typename X> static T* pointer(X & x) { return std::get<data_>(x); }
+					template<typename X> static std::ptrdiff_t row_stride(const X & x) { return std::get<row_stride_>(x); }
+					template<typename X> static std::ptrdiff_t column_stride(const X & x) { return std::get<column_stride_>(x); }
+					template<typename X> static bool integrity(const X &) { return true; }
+				};
+
+				// dense operand trait shorthand
+				template<typename X>
+				constexpr bool is_dense_v = dense_traits<std::remove_cv_t<std::remove_reference_t<X> > >::is_dense;
+
+				// address range [first, last) covered by the elements of a dense operand (empty for an empty operand)
+				auto extent = [](const auto & data) {
+					using traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >;
+					auto size{ std::ptrdiff_t(sizeof(typename traits::value_type)) };
+					auto first{ reinterpret_cast<std::uintptr_t>(traits::pointer(data)) };
+					auto nrows{ std::get<number_of_rows_>(data) };
+					auto ncols{ std::get<number_of_columns_>(data) };
+					if (nrows == 0u || ncols == 0u)
+						return std::make_pair(first, first);
+					std::ptrdiff_t low{ 0 }, high{ 0 };
+					for (auto reach : { std::ptrdiff_t(nrows - 1u) * traits::row_stride(data), std::ptrdiff_t(ncols - 1u) * traits::column_stride(data) })
+						(reach < 0 ? low : high) += reach;
+					return std::make_pair(first + std::uintptr_t(low * size), first + std::uintptr_t((high + 1) * size));
+				};
+
+				// whether the address ranges of two dense operands intersect (conservative for interleaved strides)
+				auto overlap = [](const auto & lhs, const auto & rhs) {
+					auto [lhs_first, lhs_last] { extent(lhs) };
+					auto [rhs_first, rhs_last] { extent(rhs) };
+					return lhs_first < rhs_last && rhs_first < lhs_last;
+				};
+
+				// whether two dense operands address the same elements in the same order, so that an elementwise
+				// kernel reading one and writing the other never reads an element it has already written
+				auto coincide = [](const auto & lhs, const auto & rhs) {
+					using lhs_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(lhs)> > >;
+					using rhs_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(rhs)> > >;
+					return sizeof(typename lhs_traits::value_type) == sizeof(typename rhs_traits::value_type) &&
+						static_cast<const void*>(lhs_traits::pointer(lhs)) == static_cast<const void*>(rhs_traits::pointer(rhs)) &&
+						std::get<number_of_rows_>(lhs) == std::get<number_of_rows_>(rhs) &&
+						std::get<number_of_columns_>(lhs) == std::get<number_of_columns_>(rhs) &&
+						(std::get<number_of_rows_>(lhs) <= 1u || lhs_traits::row_stride(lhs) == rhs_traits::row_stride(rhs)) &&
+						(std::get<number_of_columns_>(lhs) <= 1u || lhs_traits::column_stride(lhs) == rhs_traits::column_stride(rhs));
+				};
+
+				// bytes spanned by the elements of a dense or quantized operand (instrumentation traffic estimates)
+				auto footprint = [](const auto & data) {
+					using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+					auto elements{ std::uint64_t(std::get<number_of_rows_>(data)) * std::uint64_t(std::get<number_of_columns_>(data)) };
+					if constexpr (dense_traits<data_type>::is_dense)
+						return elements * sizeof(typename dense_traits<data_type>::value_type);
+					else
+						return elements * sizeof(typename std::tuple_element_t<data_, data_type>::value_type);
+				};
+
+				/***********************************************************************/
+				/* real-valued matrix strided views space                              */
+				/***********************************************************************/
+				namespace view {
+
+					// non-owning strided view: (rows, columns, first element, row stride, column stride);
+					// T is const-qualified for read-only views
+					template<typename T>
+					using _ = std::tuple<size_t, size_t, T*, std::ptrdiff_t, std::ptrdiff_t>;
+
+					// whole-matrix view of a matrix, an aligned matrix or another view
+					auto of = [](auto && data) {
+						using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+						using traits = dense_traits<data_type>;
+						static_assert(traits::is_dense, "views can only be taken of dense matrices");
+						static_assert(std::is_lvalue_reference_v<decltype(data)> ||
+							std::is_pointer_v<std::tuple_element_t<data_, data_type> >, "a view of a temporary matrix would dangle");
+						return std::make_tuple(std::get<number_of_rows_>(data),
+							std::get<number_of_columns_>(data),
+							traits::pointer(data),
+							traits::row_stride(data),
+							traits::column_stride(data));
+					};
+
+					// row i as a 1 x columns view
+					auto row = [](auto && data, size_t i) {
+						auto retview{ of(std::forward<decltype(data)>(data)) };
+						std::get<data_>(retview) += std::ptrdiff_t(i) * std::get<row_stride_>(retview);
+						std::get<number_of_rows_>(retview) = 1u;
+						return retview;
+					};
+
+					// column j as a rows x 1 view
+					auto column = [](auto && data, size_t j) {
+						auto retview{ of(std::forward<decltype(data)>(data)) };
+						std::get<data_>(retview) += std::ptrdiff_t(j) * std::get<column_stride_>(retview);
+						std::get<number_of_columns_>(retview) = 1u;
+						return retview;
+					};
+
+					// number_of_rows x number_of_columns sub-block starting at (i, j)
+					auto block = [](auto && data, size_t i, size_t j, size_t number_of_rows, size_t number_of_columns) {
+						auto retview{ of(std::forward<decltype(data)>(data)) };
+						if (i + number_of_rows > std::get<number_of_rows_>(retview) || j + number_of_columns > std::get<number_of_columns_>(retview))
+							throw std::runtime_error("Exception from real::valued:matrix::view::block: "
+								"block exceeds the matrix dimensions.");
+						std::get<data_>(retview) += std::ptrdiff_t(i) * std::get<row_stride_>(retview) + std::ptrdiff_t(j) * std::get<column_stride_>(retview);
+						std::get<number_of_rows_>(retview) = number_of_rows;
+						std::get<number_of_columns_>(retview) = number_of_columns;
+						return retview;
+					};
+
+					// transposed view (swaps dimensions and strides)
+					auto transpose = [](auto && data) {
+						auto retview{ of(std::forward<decltype(data)>(data)) };
+						std::swap(std::get<number_of_rows_>(retview), std::get<number_of_columns_>(retview));
+						std::swap(std::get<row_stride_>(retview), std::get<column_stride_>(retview));
+						return retview;
+					};
+
+					// data[i][j] reference
+					auto element = [](const auto & data, size_t i, size_t j) -> decltype(auto) {
+						return std::get<data_>(data)[std::ptrdiff_t(i) * std::get<row_stride_>(data) + std::ptrdiff_t(j) * std::get<column_stride_>(data)];
+					};
+
+					// materializes any dense operand into a contiguous valarray-backed matrix
+					auto copy = [](const auto & data) {
+						using traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >;
+						using value_type = typename traits::value_type;
+						auto nrows{ std::get<number_of_rows_>(data) };
+						auto ncols{ std::get<number_of_columns_>(data) };
+						auto retmat{ std::make_tuple(nrows, ncols, std::valarray<value_type>(nrows * ncols)) };
+						kernel::map(nrows, ncols, 1u, kernel::pointer(std::get<data_>(retmat)), ncols,
+							traits::pointer(data), traits::row_stride(data), traits::column_stride(data),
+							[](value_type x) { return x; });
+						return retmat;
+					};
+				}
+
+				/***********************************************************************/
+				/* real-valued int8 quantized matrix space                             */
+				/***********************************************************************/
+				namespace quantized {
+
+					// int8 quantized matrix: (rows, columns, codes, scale, zero point), entry (i, j) standing for
+					// scale * (codes[i * columns + j] - zero point)
+					using _ = std::tuple<size_t, size_t, std::valarray<std::int8_t>, float, std::int32_t>;
+
+					// quantized matrix protocols
+					constexpr size_t scale_ = 3u;
+					constexpr size_t zero_point_ = 4u;
+
+					// constructor option building a quantized matrix: matrix::constructor(rows, columns, data, quantized::tag)
+					struct tag_t {};
+					constexpr tag_t tag{};
+
+					// quantized matrix trait
+					template<typename X>
+					constexpr bool is_quantized_v = std::is_same_v<std::remove_cv_t<std::remove_reference_t<X> >, _>;
+
+					// quantized matrix integrity check
+					auto integrity_check = [](const auto & data) {
+						return std::get<number_of_rows_>(data) * std::get<number_of_columns_>(data) == std::get<data_>(data).size() &&
+							std::get<scale_>(data) > 0.0f;
+					};
+
+					// affine quantization of any dense operand over its [min, max] range (widened to contain 0,
+					// so zeros are represented exactly)
+					auto quantize = [](const auto & data, const auto &... policy) {
+						using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+						using traits = dense_traits<data_type>;
+						static_assert(traits::is_dense, "only dense matrices can be quantized");
+						if (!traits::integrity(data))
+							throw std::runtime_error("Exception from real::valued:matrix::quantized::quantize: "
+								"matrix integrity adjustment is breached.");
+						auto nrows{ std::get<number_of_rows_>(data) };
+						auto ncols{ std::get<number_of_columns_>(data) };
+						const auto* a{ traits::pointer(data) };
+						auto rsa{ traits::row_stride(data) };
+						auto csa{ traits::column_stride(data) };
+						float lo{ 0.0f };
+						float hi{ 0.0f };
+						for (size_t i{ 0u }; i < nrows; ++i)
+							for (size_t j{ 0u }; j < ncols; ++j) {
+								auto x{ float(a[std::ptrdiff_t(i) * rsa + std::ptrdiff_t(j) * csa]) };
+								lo = std::min(lo, x);
+								hi = std::max(hi, x);
+							}
+						auto scale{ hi > lo ? (hi - lo) / 255.0f : 1.0f };
+						auto zero_point{ std::int32_t(std::clamp(std::nearbyint(-128.0f - lo / scale), -128.0f, 127.0f)) };
+						auto retmat{ std::make_tuple(nrows, ncols, std::valarray<std::int8_t>(nrows * ncols), scale, zero_point) };
+						kernel::map(nrows, ncols, concurrency::degree(policy...), kernel::pointer(std::get<data_>(retmat)), ncols, a, rsa, csa,
+							[scale, zero_point](const auto & x) {
+								return std::int8_t(std::clamp(std::nearbyint(float(x) / scale) + float(zero_point), -128.0f, 127.0f));
+							});
+						return retmat;
+					};
+
+					// quantized matrix constructor from a container of real values (rows x columns, row-major)
+					auto constructor = [](size_t number_of_rows, size_t number_of_columns, const auto & data) {
+						std::vector<float> values(number_of_rows * number_of_columns, 0.0f);
+						std::copy_n(std::begin(data), std::min(std::size(data), values.size()), values.begin());
+						return quantize(view::_<const float>{ number_of_rows, number_of_columns, values.data(), std::ptrdiff_t(number_of_columns), 1 });
+					};
+
+					// real-valued (float) matrix of a quantized matrix
+					auto dequantize = [](const auto & data, const auto &... policy) {
+						auto nrows{ std::get<number_of_rows_>(data) };
+						auto ncols{ std::get<number_of_columns_>(data) };
+						auto scale{ std::get<scale_>(data) };
+						auto zero_point{ std::get<zero_point_>(data) };
+						auto retmat{ std::make_tuple(nrows, ncols, std::valarray<float>(nrows * ncols)) };
+						kernel::map(nrows, ncols, concurrency::degree(policy...), kernel::pointer(std::get<data_>(retmat)), ncols,
+							kernel::pointer(std::get<data_>(data)), std::ptrdiff_t(ncols), 1,
+							[scale, zero_point](std::int8_t q) { return scale * float(std::int32_t(q) - zero_point); });
+						return retmat;
+					};
+
+					// depth over which float sums of int8 code products (at most 2^14 in magnitude) stay exact
+					constexpr size_t exact_depth_ = 1024u;
+
+					// quantized matrix multiplication into a real-valued (float) matrix: the int8 codes are multiplied
+					// with int32 accumulation and the zero points are folded in afterwards through row and column sums,
+					// scale_a scale_b (sum q_a q_b - z_b sum q_a - z_a sum q_b + k z_a z_b); each exact_depth_ slice of
+					// the code product runs on the float kernel, whose sums are exact there, and is summed in int32
+					auto multiplication = [](const auto & lhs, const auto & rhs, const auto &... policy) {
+						if (!integrity_check(lhs) || !integrity_check(rhs))
+							throw std::runtime_error("Exception from real::valued:matrix::quantized::multiplication: "
+								"matrix integrity adjustment is breached.");
+						if (std::get<number_of_columns_>(lhs) != std::get<number_of_rows_>(rhs))
+							throw std::runtime_error("Exception from real::valued:matrix::quantized::multiplication: "
+								"matrices dimensions are not compatible for matrix multiplication.");
+						auto nrows{ std::get<number_of_rows_>(lhs) };
+						auto ncols{ std::get<number_of_columns_>(rhs) };
+						auto depth{ std::get<number_of_columns_>(lhs) };
+						auto threads{ concurrency::degree(policy...) };
+						const auto* a{ kernel::pointer(std::get<data_>(lhs)) };
+						const auto* b{ kernel::pointer(std::get<data_>(rhs)) };
+						auto retmat{ std::make_tuple(nrows, ncols, std::valarray<float>(nrows * ncols)) };
+						if (nrows == 0u || ncols == 0u)
+							return retmat;
+
+						thread_local kernel::workspace<std::int32_t> product_workspace;
+						thread_local kernel::workspace<float> slice_workspace;
+						auto* product{ product_workspace.data(nrows * ncols + nrows + ncols) };
+						auto* row_sums{ product + nrows * ncols };
+						auto* column_sums{ row_sums + nrows };
+						auto* slice{ slice_workspace.data(nrows * ncols) };
+						std::fill_n(product, nrows * ncols, std::int32_t(0));
+						for (size_t pc{ 0u }; pc < depth; pc += exact_depth_) {
+							kernel::gemm(nrows, ncols, std::min(exact_depth_, depth - pc), 1.0f, a + pc, std::ptrdiff_t(depth), 1,
+								b + pc * ncols, std::ptrdiff_t(ncols), 1, 0.0f, slice, ncols, threads);
+							concurrency::parallel_for(0u, nrows * ncols, concurrency::parallel_grain, threads, [=](size_t first, size_t last) {
+								for (auto k{ first }; k < last; ++k)
+									product[k] += std::int32_t(slice[k]);
+							});
+						}
+						for (size_t i{ 0u }; i < nrows; ++i)
+							row_sums[i] = std::accumulate(a + i * depth, a + (i + 1u) * depth, std::int32_t(0));
+						std::fill_n(column_sums, ncols, std::int32_t(0));
+						for (size_t p{ 0u }; p < depth; ++p)
+							for (size_t j{ 0u }; j < ncols; ++j)
+								column_sums[j] += b[p * ncols + j];
+
+						auto za{ std::get<zero_point_>(lhs) };
+						auto zb{ std::get<zero_point_>(rhs) };
+						auto scale{ std::get<scale_>(lhs) * std::get<scale_>(rhs) };
+						auto offset{ std::int32_t(depth) * za * zb };
+						auto* c{ kernel::pointer(std::get<data_>(retmat)) };
+						concurrency::parallel_for(0u, nrows, std::max<size_t>(concurrency::parallel_grain / ncols, 1u), threads, [=](size_t first, size_t last) {
+							for (auto i{ first }; i < last; ++i) {
+								auto row_offset{ offset - zb * row_sums[i] };
+								for (size_t j{ 0u }; j < ncols; ++j)
+									c[i * ncols + j] = scale * float(product[i * ncols + j] + row_offset - za * column_sums[j]);
+							}
+						});
+						return retmat;
+					};
+				}
+
+				// matrix constructor; the quantized::tag option quantizes the values into a quantized::_ instead
+				auto constructor = [](size_t number_of_rows, size_t number_of_columns, const auto & data, const auto &... option) {
+					using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+					if constexpr ((std::is_same_v<std::remove_cv_t<std::remove_reference_t<decltype(option)> >, quantized::tag_t> || ...)) {
+						HPMX_INSTRUMENT("constructor", number_of_rows, number_of_columns, 0u,
+							std::uint64_t(number_of_rows) * number_of_columns * (sizeof(float) + sizeof(std::int8_t)));
+						if constexpr (precision::is_element_v<data_type>)
+							return quantized::constructor(number_of_rows, number_of_columns, std::vector<float>(number_of_rows * number_of_columns, float(data)));
+						else
+							return quantized::constructor(number_of_rows, number_of_columns, data);
+					}
+					else if constexpr (precision::is_element_v<data_type>) {
+						HPMX_INSTRUMENT("constructor", number_of_rows, number_of_columns, 0u,
+							std::uint64_t(number_of_rows) * number_of_columns * sizeof(data_type));
+						return std::make_tuple(number_of_rows,
+							number_of_columns,
+							std::valarray<data_type>(data, number_of_rows * number_of_columns));
+					}
+					else {
+						using data_value_type = typename data_type::value_type;
+						HPMX_INSTRUMENT("constructor", number_of_rows, number_of_columns, 0u,
+							std::uint64_t(number_of_rows) * number_of_columns * sizeof(data_value_type) * 2u);
+						auto retmat{ std::make_tuple(number_of_rows, number_of_columns,
+						std::valarray<data_value_type>(data_value_type(0), number_of_rows * number_of_columns)) };
+						auto minsize{ std::min(std::size(data), std::get<data_>(retmat).size()) };
+						auto it = std::begin(data);
+						for (auto i{ 0u }; i < minsize; ++i) {
+							std::get<data_>(retmat)[i] = *it;
+							it = std::next(it);
+						}
+						return retmat;
+					}
+				};
+
+				// matrix display (quantized matrices are shown dequantized)
+				auto display = [](std::string_view title, const auto& data) {
+					using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+					using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
+					auto print = [title](const auto & values) {
+						std::cout << std::right;
+						std::cout << title << " (" << std::get<number_of_rows_>(values) << " x " << std::get<number_of_columns_>(values) << ")\n\n";
+						for (auto i{ 0u }; i < std::get<number_of_rows_>(values); ++i) {
+							for (auto j{ 0u }; j < std::get<number_of_columns_>(values); ++j)
+								std::cout << std::setw(16) << std::get<data_>(values)[i * std::get<number_of_columns_>(values) + j];
+							std::cout << '\n';
+						}
+						std::cout << std::flush;
+					};
+					if constexpr (quantized::is_quantized_v<data_type>)
+						print(quantized::dequantize(data));
+					else if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >)
+						print(data);
+				};
+
+				/***********************************************************************/
+				/* real-valued matrix space real-valued matrix getters space           */
+				/***********************************************************************/
+				namespace get {
+
+					/*******************************************************************/
+					/* row getters space                                               */
+					/*******************************************************************/
+					namespace row {
+
+						// row reference getter
+						auto ref = [](auto & data, size_t i) {
+							using data_type = std::remove_reference_t<decltype(data)>;
+							using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
+							if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
+								HPMX_INSTRUMENT("get::row::ref", 1u, std::get<number_of_columns_>(data), 0u,
+									std::uint64_t(std::get<number_of_columns_>(data)) * sizeof(data_value_type));
+								return std::get<data_>(data)[std::slice(i * std::get<number_of_columns_>(data),
+									std::get<number_of_columns_>(data),
+									1u)];
+							}
+						};
+
+						// row copy getter
+						auto copy = [](const auto & data, size_t i) {
+							using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+							using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
+							if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
+								HPMX_INSTRUMENT("get::row::copy", 1u, std::get<number_of_columns_>(data), 0u,
+									std::uint64_t(std::get<number_of_columns_>(data)) * sizeof(data_value_type));
+								return std::get<data_>(data)[std::slice(i * std::get<number_of_columns_>(data),
+									std::get<number_of_columns_>(data),
+									1u)];
+							}
+						};
+					}
+
+					/*******************************************************************/
+					/* column getters space                                            */
+					/*******************************************************************/
+					namespace column {
+						
+						// column reference getter
+						auto ref = [](auto & data, size_t j) {
+							using data_type = std::remove_reference_t<decltype(data)>;
+							using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
+							if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
+								HPMX_INSTRUMENT("get::column::ref", std::get<number_of_rows_>(data), 1u, 0u,
+									std::uint64_t(std::get<number_of_rows_>(data)) * sizeof(data_value_type));
+								return std::get<data_>(data)[std::slice(j, 
+									std::get<number_of_rows_>(data),
+									std::get<number_of_columns_>(data))];
+							}
+						};
+
+						// column copy getter
+						auto copy = [](const auto & data, size_t j) {
+							using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+							using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
+							if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
+								HPMX_INSTRUMENT("get::column::copy", std::get<number_of_rows_>(data), 1u, 0u,
+									std::uint64_t(std::get<number_of_rows_>(data)) * sizeof(data_value_type));
+								return std::get<data_>(data)[std::slice(j,
+									std::get<number_of_rows_>(data),
+									std::get<number_of_columns_>(data))];
+							}
+						};
+					}
+
+					// data[i][j] value getter
+					auto data = [](const auto & mat, size_t i, size_t j) {
+						using data_type = std::remove_cv_t<std::remove_reference_t<decltype(mat)> >;
+						using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
+						if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
+							HPMX_INSTRUMENT("get::data", 1u, 1u, 0u, sizeof(data_value_type));
+							return std::get<data_>(mat)[i * std::get<number_of_columns_>(mat) + j];
+						}
+					};
+				}
+
+				/***********************************************************************/
+				/* real-valued matrix space real-valued matrix setters space           */
+				/***********************************************************************/
+				namespace set {
+
+					/*******************************************************************/
+					/* row setters space                                               */
+					/*******************************************************************/
+					auto row = [](auto && data, size_t i, auto&& value, auto... args) {
+						using data_type = std::remove_reference_t<decltype(data)>;
+						using data_value_type = typename dense_traits<std::remove_cv_t<data_type> >::value_type;
+						HPMX_INSTRUMENT("set::row", 1u, std::get<number_of_columns_>(data), 0u,
+							std::uint64_t(std::get<number_of_columns_>(data)) * sizeof(data_value_type));
+						if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
+							using value_type = std::remove_reference_t<decltype(value)>;
+							if constexpr (std::is_arithmetic_v<value_type>)
+								std::get<data_>(data)[std::slice(i * std::get<number_of_columns_>(data),
+									std::get<number_of_columns_>(data),
+									1u)] = value;
+							else if constexpr (std::is_invocable_v<value_type, decltype(args)...> &&
+								std::is_arithmetic_v<std::invoke_result_t<value_type, decltype(args)...> >) {
+								std::get<data_>(data)[std::slice(i * std::get<number_of_columns_>(data),
+									std::get<number_of_columns_>(data),
+									1u)] = value(args...);
+							}
+						}
+						else if constexpr (dense_traits<std::remove_cv_t<data_type> >::is_dense) {
+							using traits = dense_traits<std::remove_cv_t<data_type> >;
+							using value_type = std::remove_reference_t<decltype(value)>;
+							auto* first{ traits::pointer(data) + std::ptrdiff_t(i) * traits::row_stride(data) };
+							if constexpr (std::is_arithmetic_v<value_type>)
+								kernel::fill(first, std::get<number_of_columns_>(data), traits::column_stride(data), data_value_type(value));
+							else if constexpr (std::is_invocable_v<value_type, decltype(args)...> &&
+								std::is_arithmetic_v<std::invoke_result_t<value_type, decltype(args)...> >)
+								kernel::fill(first, std::get<number_of_columns_>(data), traits::column_stride(data), data_value_type(value(args...)));
+						}
+					};
+
+					/*******************************************************************/
+					/* column setters space                                            */
+					/*******************************************************************/
+					auto column = [](auto && data, size_t j, auto && value, auto... args) {
+						using data_type = std::remove_reference_t<decltype(data)>;
+						using data_value_type = typename dense_traits<std::remove_cv_t<data_type> >::value_type;
+						HPMX_INSTRUMENT("set::column", std::get<number_of_rows_>(data), 1u, 0u,
+							std::uint64_t(std::get<number_of_rows_>(data)) * sizeof(data_value_type));
+						if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
+							using value_type = std::remove_reference_t<decltype(value)>;
+							if constexpr (std::is_arithmetic_v<value_type>)
+								std::get<data_>(data)[std::slice(j,
+									std::get<number_of_rows_>(data),
+									std::get<number_of_columns_>(data))] = value;
+							else if constexpr (std::is_invocable_v<value_type, decltype(args)...> &&
+								std::is_arithmetic_v<std::invoke_result_t<value_type, decltype(args)...> >) {
+								std::get<data_>(data)[std::slice(j,
+									std::get<number_of_rows_>(data),
+									std::get<number_of_columns_>(data))] = value(args...);
+							}
+						}
+						else if constexpr (dense_traits<std::remove_cv_t<data_type> >::is_dense) {
+							using traits = dense_traits<std::remove_cv_t<data_type> >;
+							using value_type = std::remove_reference_t<decltype(value)>;
+							auto* first{ traits::pointer(data) + std::ptrdiff_t(j) * traits::column_stride(data) };
+							if constexpr (std::is_arithmetic_v<value_type>)
+								kernel::fill(first, std::get<number_of_rows_>(data), traits::row_stride(data), data_value_type(value));
+							else if constexpr (std::is_invocable_v<value_type, decltype(args)...> &&
+								std::is_arithmetic_v<std::invoke_result_t<value_type, decltype(args)...> >)
+								kernel::fill(first, std::get<number_of_rows_>(data), traits::row_stride(data), data_value_type(value(args...)));
+						}
+					};
+
+					// data[i][j] value setter
+					auto data = [](auto && mat, size_t i, size_t j, auto&& value, auto... args) {
+						using data_type = std::remove_reference_t<decltype(mat)>;
+						using data_value_type = typename dense_traits<std::remove_cv_t<data_type> >::value_type;
+						HPMX_INSTRUMENT("set::data", 1u, 1u, 0u, sizeof(data_value_type));
+						if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
+							using value_type = std::remove_reference_t<decltype(value)>;
+							if constexpr (std::is_arithmetic_v<value_type>)
+								std::get<data_>(mat)[i * std::get<number_of_columns_>(mat) + j] = value;
+							else if constexpr (std::is_invocable_v<value_type, decltype(args)...> &&
+								std::is_arithmetic_v<std::invoke_result_t<value_type, decltype(args)...> >) {
+								std::get<data_>(mat)[i * std::get<number_of_columns_>(mat) + j] = value(args...);
+							}
+						}
+						else if constexpr (dense_traits<std::remove_cv_t<data_type> >::is_dense) {
+							using traits = dense_traits<std::remove_cv_t<data_type> >;
+							using value_type = std::remove_reference_t<decltype(value)>;
+							auto* first{ traits::pointer(mat) + std::ptrdiff_t(i) * traits::row_stride(mat) + std::ptrdiff_t(j) * traits::column_stride(mat) };
+							if constexpr (std::is_arithmetic_v<value_type>)
+								kernel::fill(first, 1u, 0, data_value_type(value));
+							else if constexpr (std::is_invocable_v<value_type, decltype(args)...> &&
+								std::is_arithmetic_v<std::invoke_result_t<value_type, decltype(args)...> >)
+								kernel::fill(first, 1u, 0, data_value_type(value(args...)));
+						}
+					};
+				}
+
+				// real-valued matrix generator: a stateful fn(args...) is called once per element in row-major order;
+				// an index-aware fn(i, j) or fn(linear index) is called in parallel and vectorizable row runs, the
+				// trailing arguments then being execution policies
+				auto generator = [](size_t number_of_rows, size_t number_of_columns, auto && fn, auto... args) {
+					using data_type = std::remove_reference_t<decltype(fn)>;
+					if constexpr (std::is_invocable_v<data_type, decltype(args)...>) {
+						using return_type = std::invoke_result_t<data_type, decltype(args)...>;
+						HPMX_INSTRUMENT("generator", number_of_rows, number_of_columns, 0u,
+							std::uint64_t(number_of_rows) * number_of_columns * sizeof(return_type));
+						auto retmat{ std::make_tuple(number_of_rows,
+							number_of_columns,
+							std::valarray<return_type>(return_type(0), number_of_rows * number_of_columns)) };
+						for (auto& elem : std::get<data_>(retmat))
+							elem = fn(args...);
+						return retmat;
+					}
+					else if constexpr (std::is_invocable_v<data_type, size_t, size_t>) {
+						using return_type = std::invoke_result_t<data_type, size_t, size_t>;
+						HPMX_INSTRUMENT("generator", number_of_rows, number_of_columns, 0u,
+							std::uint64_t(number_of_rows) * number_of_columns * sizeof(return_type));
+						auto retmat{ std::make_tuple(number_of_rows,
+							number_of_columns,
+							std::valarray<return_type>(number_of_rows * number_of_columns)) };
+						auto* c{ kernel::pointer(std::get<data_>(retmat)) };
+						concurrency::parallel_for(0u, number_of_rows, std::max<size_t>(concurrency::parallel_grain / std::max<size_t>(number_of_columns, 1u), 1u),
+							concurrency::degree(args...), [c, number_of_columns, &fn](size_t first, size_t last) {
+								for (auto i{ first }; i < last; ++i)
+									for (size_t j{ 0u }; j < number_of_columns; ++j)
+										c[i * number_of_columns + j] = fn(i, j);
+							});
+						return retmat;
+					}
+					else if constexpr (std::is_invocable_v<data_type, size_t>) {
+						using return_type = std::invoke_result_t<data_type, size_t>;
+						HPMX_INSTRUMENT("generator", number_of_rows, number_of_columns, 0u,
+							std::uint64_t(number_of_rows) * number_of_columns * sizeof(return_type));
+						auto retmat{ std::make_tuple(number_of_rows,
+							number_of_columns,
+							std::valarray<return_type>(number_of_rows * number_of_columns)) };
+						auto* c{ kernel::pointer(std::get<data_>(retmat)) };
+						concurrency::parallel_for(0u, number_of_rows * number_of_columns, concurrency::parallel_grain,
+							concurrency::degree(args...), [c, &fn](size_t first, size_t last) {
+								for (auto k{ first }; k < last; ++k)
+									c[k] = fn(k);
+							});
+						return retmat;
+					}
+				};
+
+				/***********************************************************************/
+				/* real-valued matrix counter-based random fills space                 */
+				/***********************************************************************/
+				namespace random {
+
+					// uniform and normal fills: element k of a matrix is drawn from the philox block k / lanes of
+					// the seed, so a fill is reproducible for a given seed whatever the number of threads
+					auto fill = [](size_t number_of_rows, size_t number_of_columns, std::uint64_t seed, auto draw, const auto &... policy) {
+						using value_type = std::remove_reference_t<decltype(draw(std::array<std::uint32_t, 4u>{})[0])>;
+						constexpr size_t lanes{ std::tuple_size_v<decltype(draw(std::array<std::uint32_t, 4u>{}))> };
+						auto count{ number_of_rows * number_of_columns };
+						auto retmat{ std::make_tuple(number_of_rows, number_of_columns, std::valarray<value_type>(count)) };
+						auto* c{ kernel::pointer(std::get<data_>(retmat)) };
+						concurrency::parallel_for(0u, (count + lanes - 1u) / lanes, concurrency::parallel_grain / lanes, concurrency::degree(policy...),
+							[c, count, seed, &draw](size_t first, size_t last) {
+								// philox blocks are generated in structure-of-arrays batches, which vectorize
+								constexpr size_t batch{ 16u };
+								std::uint32_t words[4u][batch];
+								for (auto base{ first }; base < last; base += batch) {
+									for (size_t b{ 0u }; b < batch; ++b) {
+										auto x{ kernel::philox(std::uint64_t(base + b), seed) };
+										for (size_t w{ 0u }; w < 4u; ++w)
+											words[w][b] = x[w];
+									}
+									for (size_t b{ 0u }; b < std::min(batch, last - base); ++b) {
+										auto block{ base + b };
+										auto values{ draw(std::array<std::uint32_t, 4u>{ words[0][b], words[1][b], words[2][b], words[3][b] }) };
+										if ((block + 1u) * lanes <= count)
+											std::memcpy(c + block * lanes, values.data(), sizeof(values));
+										else
+											std::copy_n(values.data(), count - block * lanes, c + block * lanes);
+									}
+								}
+							});
+						return retmat;
+					};
+
+					// [0, 1) uniforms of the 32 (float) or 64 (double) bit words of a philox block
+					template<typename T>
+					auto unit_uniforms(const std::array<std::uint32_t, 4u> & bits) {
+						if constexpr (sizeof(T) <= 4u)
+							return std::array<T, 4u>{ T(bits[0] >> 8) * T(0x1.0p-24), T(bits[1] >> 8) * T(0x1.0p-24),
+								T(bits[2] >> 8) * T(0x1.0p-24), T(bits[3] >> 8) * T(0x1.0p-24) };
+						else
+							return std::array<T, 2u>{ T(((std::uint64_t(bits[0]) << 32) | bits[1]) >> 11) * T(0x1.0p-53),
+								T(((std::uint64_t(bits[2]) << 32) | bits[3]) >> 11) * T(0x1.0p-53) };
+					}
+
+					// matrix of uniforms on [lo, hi)
+					auto uniform = [](size_t number_of_rows, size_t number_of_columns, std::uint64_t seed, auto lo, auto hi, const auto &... policy) {
+						using value_type = std::common_type_t<decltype(lo), decltype(hi)>;
+						static_assert(std::is_floating_point_v<value_type>, "uniform fills are floating-point");
+						return fill(number_of_rows, number_of_columns, seed, [lo = value_type(lo), width = value_type(hi) - value_type(lo)](const auto & bits) {
+							auto values{ unit_uniforms<value_type>(bits) };
+							for (auto& x : values)
+								x = lo + width * x;
+							return values;
+						}, policy...);
+					};
+
+					// matrix of normal deviates with the given mean and standard deviation (box-muller pairs)
+					auto normal = [](size_t number_of_rows, size_t number_of_columns, std::uint64_t seed, auto mean, auto stddev, const auto &... policy) {
+						using value_type = std::common_type_t<decltype(mean), decltype(stddev)>;
+						static_assert(std::is_floating_point_v<value_type>, "normal fills are floating-point");
+						return fill(number_of_rows, number_of_columns, seed, [mean = value_type(mean), stddev = value_type(stddev)](const auto & bits) {
+							auto values{ unit_uniforms<value_type>(bits) };
+							for (size_t l{ 0u }; l < values.size(); l += 2u) {
+								auto radius{ stddev * std::sqrt(value_type(-2) * std::log(value_type(1) - values[l])) };
+								auto angle{ value_type(6.283185307179586476925) * values[l + 1u] };
+								values[l] = mean + radius * std::cos(angle);
+								values[l + 1u] = mean + radius * std::sin(angle);
+							}
+							return values;
+						}, policy...);
+					};
+				}
+
+				// real-valued matrix integrity check (also accepts aligned matrices and views)
+				auto integrity_check = [](const auto& data) {
+					using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+					if constexpr (dense_traits<data_type>::is_dense)
+						return dense_traits<data_type>::integrity(data);
+					else return false;
+				};
+
+				// output option writing a result into an existing dense matrix: matrix::into(dst)
+				template<typename X>
+				struct destination_t {
+					X& target;
+				};
+
+				auto into = [](auto & target) {
+					using target_type = std::remove_cv_t<std::remove_reference_t<decltype(target)> >;
+					if constexpr (dense_traits<target_type>::is_dense)
+						static_assert(!std::is_const_v<std::remove_pointer_t<decltype(dense_traits<target_type>::pointer(target))> >,
+							"the destination is read-only (a const view or a mapped matrix opened without mapped::writable)");
+					return destination_t<std::remove_reference_t<decltype(target)> >{ target };
+				};
+
+				// output option traits
+				template<typename X>
+				struct is_destination : std::false_type {};
+
+				template<typename X>
+				struct is_destination<destination_t<X> > : std::true_type {};
+
+				template<typename... P>
+				constexpr bool has_destination_v = (is_destination<std::remove_cv_t<std::remove_reference_t<P> > >::value || ...);
+
+				// target of the first output option
+				template<typename P, typename... Rest>
+				auto& destination_of(const P & option, const Rest &... rest) {
+					if constexpr (is_destination<P>::value)
+						return option.target;
+					else
+						return destination_of(rest...);
+				}
+
+				// movable valarray-backed matrix whose storage a result of value type T can take over
+				template<typename X, typename T>
+				constexpr bool is_stealable_v = !std::is_lvalue_reference_v<X> && std::is_same_v<std::remove_reference_t<X>, _<T> >;
+
+				// shapes a destination for an nrows x ncols result: a valarray-backed matrix is resized (allocating
+				// only when its element count changes), any other dense destination must already have that shape
+				auto reshape = [](auto & target, size_t nrows, size_t ncols, const char* incompatible) {
+					using target_type = std::remove_cv_t<std::remove_reference_t<decltype(target)> >;
+					using target_value_type = typename dense_traits<target_type>::value_type;
+					if constexpr (std::is_same_v<target_type, _<target_value_type> >) {
+						if (std::get<data_>(target).size() != nrows * ncols)
+							std::get<data_>(target).resize(nrows * ncols);
+						std::get<number_of_rows_>(target) = nrows;
+						std::get<number_of_columns_>(target) = ncols;
+					}
+					else if (std::get<number_of_rows_>(target) != nrows || std::get<number_of_columns_>(target) != ncols)
+						throw std::runtime_error(incompatible);
+				};
+
+				// elementwise kernels into any dense destination with unit row or column stride (a transposed
+				// destination is walked column by column); the destination may coincide with an operand, but must
+				// not otherwise overlap one (callers route such destinations through a temporary)
+				auto map_into = [](auto & target, const auto & data, size_t threads, auto && fn) {
+					using target_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(target)> > >;
+					using data_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >;
+					auto nrows{ std::get<number_of_rows_>(data) };
+					auto ncols{ std::get<number_of_columns_>(data) };
+					auto* c{ target_traits::pointer(target) };
+					auto rsc{ target_traits::row_stride(target) };
+					auto csc{ target_traits::column_stride(target) };
+					if (csc == 1 || ncols <= 1u)
+						kernel::map(nrows, ncols, threads, c, size_t(rsc), data_traits::pointer(data),
+							data_traits::row_stride(data), data_traits::column_stride(data), fn);
+					else if (rsc == 1 || nrows <= 1u)
+						kernel::map(ncols, nrows, threads, c, size_t(csc), data_traits::pointer(data),
+							data_traits::column_stride(data), data_traits::row_stride(data), fn);
+					else
+						throw std::runtime_error("Exception from real::valued:matrix::map_into: "
+							"the destination has no unit stride.");
+				};
+
+				auto zip_into = [](auto & target, const auto & lhs, const auto & rhs, size_t threads, auto && fn) {
+					using target_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(target)> > >;
+					using lhs_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(lhs)> > >;
+					using rhs_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(rhs)> > >;
+					auto nrows{ std::get<number_of_rows_>(lhs) };
+					auto ncols{ std::get<number_of_columns_>(lhs) };
+					auto* c{ target_traits::pointer(target) };
+					auto rsc{ target_traits::row_stride(target) };
+					auto csc{ target_traits::column_stride(target) };
+					if (csc == 1 || ncols <= 1u)
+						kernel::zip(nrows, ncols, threads, c, size_t(rsc),
+							lhs_traits::pointer(lhs), lhs_traits::row_stride(lhs), lhs_traits::column_stride(lhs),
+							rhs_traits::pointer(rhs), rhs_traits::row_stride(rhs), rhs_traits::column_stride(rhs), fn);
+					else if (rsc == 1 || nrows <= 1u)
+						kernel::zip(ncols, nrows, threads, c, size_t(csc),
+							lhs_traits::pointer(lhs), lhs_traits::column_stride(lhs), lhs_traits::row_stride(lhs),
+							rhs_traits::pointer(rhs), rhs_traits::column_stride(rhs), rhs_traits::row_stride(rhs), fn);
+					else
+						throw std::runtime_error("Exception from real::valued:matrix::zip_into: "
+							"the destination has no unit stride.");
+				};
+
+				// whether fn maps an element of type T to a value storable as T; the reduced-precision formats only
+				// convert explicitly, so any result they are constructible from is accepted
+				template<typename T, typename F, typename = void>
+				constexpr bool is_element_function_v = std::is_invocable_r_v<T, F, const T&>;
+
+				template<typename T, typename F>
+				constexpr bool is_element_function_v<T, F, std::enable_if_t<precision::is_reduced_v<T> && std::is_invocable_v<F, const T&> > > =
+					std::is_constructible_v<T, std::invoke_result_t<F, const T&> >;
+
+				// real-valued matrix apply function (also accepts aligned matrices and views); a temporary
+				// matrix::_ operand is transformed in place and returned, into(dst) writes into dst instead (through
+				// a temporary when dst overlaps the operand without coinciding with it)
+				auto apply = [](auto && data, auto&& fn, const auto &... policy) {
+					using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+					if constexpr (dense_traits<data_type>::is_dense) {
+						using traits = dense_traits<data_type>;
+						using data_value_type = typename traits::value_type;
+						using fn_type = std::remove_reference_t<decltype(fn)>;
+						if constexpr (is_element_function_v<data_value_type, fn_type>) {
+							auto nrows{ std::get<number_of_rows_>(data) };
+							auto ncols{ std::get<number_of_columns_>(data) };
+							HPMX_INSTRUMENT("apply", nrows, ncols, std::uint64_t(nrows) * ncols, 2u * footprint(data));
+							auto op = [&fn](const data_value_type& x) { return data_value_type(fn(x)); };
+							if constexpr (has_destination_v<decltype(policy)...>) {
+								auto& target{ destination_of(policy...) };
+								using target_value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(target)> > >::value_type;
+								auto incompatible{ "Exception from real::valued:matrix::apply: "
+									"the destination dimensions are not compatible with the result." };
+								if (overlap(target, data) && !coincide(target, data)) {
+									auto retmat{ std::make_tuple(nrows, ncols, std::valarray<data_value_type>(nrows * ncols)) };
+									map_into(retmat, data, concurrency::degree(policy...), op);
+									reshape(target, nrows, ncols, incompatible);
+									map_into(target, retmat, concurrency::degree(policy...), [](const data_value_type& x) { return target_value_type(x); });
+								}
+								else {
+									reshape(target, nrows, ncols, incompatible);
+									map_into(target, data, concurrency::degree(policy...), op);
+								}
+							}
+							else if constexpr (is_stealable_v<decltype(data), data_value_type>) {
+								map_into(data, data, concurrency::degree(policy...), op);
+								return std::move(data);
+							}
+							else {
+								auto retmat{ std::make_tuple(nrows, ncols, std::valarray<data_value_type>(nrows * ncols)) };
+								map_into(retmat, data, concurrency::degree(policy...), op);
+								return retmat;
+							}
+						}
+					}
+				};
+
+				// in-place apply: data(i, j) = fn(data(i, j)) on any mutable dense operand
+				auto apply_inplace = [](auto & data, auto && fn, const auto &... policy) {
+					using data_value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+					if (!real::valued::matrix::integrity_check(data))
+						throw std::runtime_error("Exception from real::valued:matrix::apply_inplace: "
+							"matrix integrity adjustment is breached.");
+					map_into(data, data, concurrency::degree(policy...), [&fn](const data_value_type& x) { return data_value_type(fn(x)); });
+				};
+
+				// elementwise binary operation shared by addition and subtraction: into(dst) writes into dst (through
+				// a temporary when dst overlaps an operand without coinciding with it), a temporary matrix::_ operand
+				// of the result type lends its storage, otherwise a matrix is allocated
+				auto elementwise = [](auto && lhs, auto && rhs, auto op, const char* incompatible, const char* breached, const auto &... policy) {
+
+					using lhs_type = std::remove_cv_t<std::remove_reference_t<decltype(lhs)> >;
+					using rhs_type = std::remove_cv_t<std::remove_reference_t<decltype(rhs)> >;
+
+					if constexpr (dense_traits<lhs_type>::is_dense && dense_traits<rhs_type>::is_dense) {
+
+						using lhs_value_type = typename dense_traits<lhs_type>::value_type;
+
+						if (real::valued::matrix::integrity_check(lhs) && real::valued::matrix::integrity_check(rhs)) {
+							if ((std::get<number_of_rows_>(lhs) == std::get<number_of_rows_>(rhs)) &&
+								(std::get<number_of_columns_>(lhs) == std::get<number_of_columns_>(rhs))) {
+
+								auto nrows{ std::get<number_of_rows_>(lhs) };
+								auto ncols{ std::get<number_of_columns_>(lhs) };
+								auto fn = [&op](const auto & a, const auto & b) { return lhs_value_type(op(a, b)); };
+								if constexpr (has_destination_v<decltype(policy)...>) {
+									auto& target{ destination_of(policy...) };
+									using target_value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(target)> > >::value_type;
+									auto into_target = [&op](const auto & a, const auto & b) { return target_value_type(op(a, b)); };
+									if ((overlap(target, lhs) && !coincide(target, lhs)) || (overlap(target, rhs) && !coincide(target, rhs))) {
+										auto retmat{ std::make_tuple(nrows, ncols, std::valarray<target_value_type>(nrows * ncols)) };
+										zip_into(retmat, lhs, rhs, concurrency::degree(policy...), into_target);
+										reshape(target, nrows, ncols, incompatible);
+										map_into(target, retmat, concurrency::degree(policy...), [](const target_value_type& x) { return x; });
+									}
+									else {
+										reshape(target, nrows, ncols, incompatible);
+										zip_into(target, lhs, rhs, concurrency::degree(policy...), into_target);
+									}
+								}
+								else if constexpr (is_stealable_v<decltype(lhs), lhs_value_type>) {
+									zip_into(lhs, lhs, rhs, concurrency::degree(policy...), fn);
+									return std::move(lhs);
+								}
+								else if constexpr (is_stealable_v<decltype(rhs), lhs_value_type>) {
+									zip_into(rhs, lhs, rhs, concurrency::degree(policy...), fn);
+									return std::move(rhs);
+								}
+								else {
+									auto retmat{ std::make_tuple(nrows, ncols, std::valarray<lhs_value_type>(nrows * ncols)) };
+									zip_into(retmat, lhs, rhs, concurrency::degree(policy...), fn);
+									return retmat;
+								}
+							}
+							else
+								throw std::runtime_error(incompatible);
+						}
+						else
+							throw std::runtime_error(breached);
+					}
+				};
+
+				// real-valued matrix addition function (also accepts aligned matrices and views)
+				auto addition = [](auto && lhs, auto && rhs, const auto &... policy) {
+					HPMX_INSTRUMENT("addition", std::get<number_of_rows_>(lhs), std::get<number_of_columns_>(lhs),
+						std::uint64_t(std::get<number_of_rows_>(lhs)) * std::get<number_of_columns_>(lhs), 3u * footprint(lhs));
+					return elementwise(std::forward<decltype(lhs)>(lhs), std::forward<decltype(rhs)>(rhs), std::plus<>{},
+						"Exception from real::valued:matrix::addition: matrices dimensions are not compatible with each other.",
+						"Exception from real::valued:matrix::addition: matrix integrity adjustment is breached.",
+						policy...);
+				};
+
+				// real-valued matrix subtraction function (also accepts aligned matrices and views)
+				auto subtraction = [](auto && lhs, auto && rhs, const auto &... policy) {
+					HPMX_INSTRUMENT("subtraction", std::get<number_of_rows_>(lhs), std::get<number_of_columns_>(lhs),
+						std::uint64_t(std::get<number_of_rows_>(lhs)) * std::get<number_of_columns_>(lhs), 3u * footprint(lhs));
+					return elementwise(std::forward<decltype(lhs)>(lhs), std::forward<decltype(rhs)>(rhs), std::minus<>{},
+						"Exception from real::valued:matrix::subtraction: matrices dimensions are not compatible with each other.",
+						"Exception from real::valued:matrix::subtraction: matrix integrity adjustment is breached.",
+						policy...);
+				};
+
+				// in-place addition: lhs += rhs on any mutable dense lhs
+				auto add_inplace = [](auto & lhs, const auto & rhs, const auto &... policy) {
+					elementwise(lhs, rhs, std::plus<>{},
+						"Exception from real::valued:matrix::add_inplace: matrices dimensions are not compatible with each other.",
+						"Exception from real::valued:matrix::add_inplace: matrix integrity adjustment is breached.",
+						into(lhs), policy...);
+				};
+
+				// in-place subtraction: lhs -= rhs on any mutable dense lhs
+				auto sub_inplace = [](auto & lhs, const auto & rhs, const auto &... policy) {
+					elementwise(lhs, rhs, std::minus<>{},
+						"Exception from real::valued:matrix::sub_inplace: matrices dimensions are not compatible with each other.",
+						"Exception from real::valued:matrix::sub_inplace: matrix integrity adjustment is breached.",
+						into(lhs), policy...);
+				};
+
+				// scaled in-place accumulation: y += alpha * x on any mutable dense y
+				auto axpy = [](auto alpha, const auto & x, auto & y, const auto &... policy) {
+					elementwise(x, y, [alpha](const auto & a, const auto & b) { return alpha * a + b; },
+						"Exception from real::valued:matrix::axpy: matrices dimensions are not compatible with each other.",
+						"Exception from real::valued:matrix::axpy: matrix integrity adjustment is breached.",
+						into(y), policy...);
+				};
+
+				// real-valued matrix multiplication function (also accepts aligned matrices and views, e.g. transposes);
+				// into(dst) writes the product into dst, through a temporary when dst overlaps an operand;
+				// two quantized operands multiply in int8 with int32 accumulation into a float matrix
+				auto multiplication = [](const auto & lhs, const auto & rhs, const auto &... policy) {
+
+					using lhs_type = std::remove_cv_t<std::remove_reference_t<decltype(lhs)> >;
+					using rhs_type = std::remove_cv_t<std::remove_reference_t<decltype(rhs)> >;
+
+					if constexpr (quantized::is_quantized_v<lhs_type> && quantized::is_quantized_v<rhs_type>) {
+						HPMX_INSTRUMENT("multiplication", std::get<number_of_rows_>(lhs), std::get<number_of_columns_>(rhs),
+							2u * std::uint64_t(std::get<number_of_rows_>(lhs)) * std::get<number_of_columns_>(rhs) * std::get<number_of_columns_>(lhs),
+							footprint(lhs) + footprint(rhs) + std::uint64_t(std::get<number_of_rows_>(lhs)) * std::get<number_of_columns_>(rhs) * sizeof(float));
+						return quantized::multiplication(lhs, rhs, policy...);
+					}
+					else if constexpr (dense_traits<lhs_type>::is_dense && dense_traits<rhs_type>::is_dense) {
+
+						using lhs_traits = dense_traits<lhs_type>;
+						using rhs_traits = dense_traits<rhs_type>;
+						using lhs_value_type = typename lhs_traits::value_type;
+						using rhs_value_type = typename rhs_traits::value_type;
+
+						if (real::valued::matrix::integrity_check(lhs) && real::valued::matrix::integrity_check(rhs)) {
+							if (std::get<number_of_columns_>(lhs) == std::get<number_of_rows_>(rhs)) {
+
+								auto nrows{ std::get<number_of_rows_>(lhs) };
+								auto ncols{ std::get<number_of_columns_>(rhs) };
+								auto depth{ std::get<number_of_columns_>(lhs) };
+								using return_value_type = std::common_type_t<lhs_value_type, rhs_value_type>;
+								HPMX_INSTRUMENT("multiplication", nrows, ncols, 2u * std::uint64_t(nrows) * ncols * depth,
+									footprint(lhs) + footprint(rhs) + std::uint64_t(nrows) * ncols * sizeof(return_value_type));
+
+								// C = A B into a destination with unit column stride, or C^T = B^T A^T into a transposed one
+								auto product = [&](auto & target) {
+									using target_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(target)> > >;
+									using target_value_type = typename target_traits::value_type;
+									auto* c{ target_traits::pointer(target) };
+									auto rsc{ target_traits::row_stride(target) };
+									auto csc{ target_traits::column_stride(target) };
+									if (csc == 1 || ncols <= 1u)
+										kernel::gemm(nrows, ncols, depth,
+											target_value_type(1), lhs_traits::pointer(lhs), lhs_traits::row_stride(lhs), lhs_traits::column_stride(lhs),
+											rhs_traits::pointer(rhs), rhs_traits::row_stride(rhs), rhs_traits::column_stride(rhs),
+											target_value_type(0), c, size_t(rsc), concurrency::degree(policy...));
+									else if (rsc == 1 || nrows <= 1u)
+										kernel::gemm(ncols, nrows, depth,
+											target_value_type(1), rhs_traits::pointer(rhs), rhs_traits::column_stride(rhs), rhs_traits::row_stride(rhs),
+											lhs_traits::pointer(lhs), lhs_traits::column_stride(lhs), lhs_traits::row_stride(lhs),
+											target_value_type(0), c, size_t(csc), concurrency::degree(policy...));
+									else
+										throw std::runtime_error("Exception from real::valued:matrix::multiplication: "
+											"the destination has no unit stride.");
+								};
+
+								if constexpr (has_destination_v<decltype(policy)...>) {
+									auto& target{ destination_of(policy...) };
+									using target_value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(target)> > >::value_type;
+									auto incompatible{ "Exception from real::valued:matrix::multiplication: "
+										"the destination dimensions are not compatible with the result." };
+									if (overlap(target, lhs) || overlap(target, rhs)) {
+										auto retmat{ std::make_tuple(nrows, ncols, std::valarray<target_value_type>(nrows * ncols)) };
+										product(retmat);
+										reshape(target, nrows, ncols, incompatible);
+										map_into(target, retmat, concurrency::degree(policy...), [](const target_value_type& x) { return x; });
+									}
+									else {
+										reshape(target, nrows, ncols, incompatible);
+										product(target);
+									}
+								}
+								else {
+									auto retmat{ std::make_tuple(nrows,
+										ncols,
+										std::valarray<return_value_type>(nrows * ncols)) };
+									product(retmat);
+									return retmat;
+								}
+							}
+							else
+								throw std::runtime_error("Exception from real::valued:matrix::multiplication: "
+									"matrices dimensions are not compatible for matrix multiplication. "
+									"It means that the number of columns in the left-hand side matrix is not equal to "
+									"the number of rows in the right-hand side matrix.");
+						}
+						else
+							throw std::runtime_error("Exception from real::valued:matrix::multiplication: "
+								"matrix integrity adjustment is breached.");
+					}
+				};
+
+				// transposed-operand multiplications reading the operands in their stored layout (no transposed copy):
+				// lhs^T rhs (e.g. Gram matrices and normal equations), lhs rhs^T and lhs^T rhs^T
+				auto multiplication_tn = [](const auto & lhs, const auto & rhs, const auto &... policy) {
+					return multiplication(view::transpose(lhs), rhs, policy...);
+				};
+
+				auto multiplication_nt = [](const auto & lhs, const auto & rhs, const auto &... policy) {
+					return multiplication(lhs, view::transpose(rhs), policy...);
+				};
+
+				auto multiplication_tt = [](const auto & lhs, const auto & rhs, const auto &... policy) {
+					return multiplication(view::transpose(lhs), view::transpose(rhs), policy...);
+				};
+
+				// real-valued matrix transpose function (also accepts aligned matrices and views), cache-oblivious;
+				// into(dst) writes the transpose into dst, through a temporary when dst overlaps the operand
+				auto transpose = [](const auto & data, const auto &... policy) {
+					using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+					if constexpr (dense_traits<data_type>::is_dense) {
+						using traits = dense_traits<data_type>;
+						using data_value_type = typename traits::value_type;
+						if (!real::valued::matrix::integrity_check(data))
+							throw std::runtime_error("Exception from real::valued:matrix::transpose: "
+								"matrix integrity adjustment is breached.");
+						auto nrows{ std::get<number_of_rows_>(data) };
+						auto ncols{ std::get<number_of_columns_>(data) };
+
+						// C = A^T into a destination with unit column stride, or a plain copy into a transposed one
+						auto transposed = [&](auto & target) {
+							using target_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(target)> > >;
+							using target_value_type = typename target_traits::value_type;
+							auto* c{ target_traits::pointer(target) };
+							auto rsc{ target_traits::row_stride(target) };
+							auto csc{ target_traits::column_stride(target) };
+							if (csc == 1 || nrows <= 1u)
+								kernel::transpose(nrows, ncols, concurrency::degree(policy...), c, size_t(rsc),
+									traits::pointer(data), traits::row_stride(data), traits::column_stride(data));
+							else if (rsc == 1 || ncols <= 1u)
+								kernel::map(nrows, ncols, concurrency::degree(policy...), c, size_t(csc),
+									traits::pointer(data), traits::row_stride(data), traits::column_stride(data),
+									[](const data_value_type& x) { return target_value_type(x); });
+							else
+								throw std::runtime_error("Exception from real::valued:matrix::transpose: "
+									"the destination has no unit stride.");
+						};
+
+						if constexpr (has_destination_v<decltype(policy)...>) {
+							auto& target{ destination_of(policy...) };
+							using target_value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(target)> > >::value_type;
+							auto incompatible{ "Exception from real::valued:matrix::transpose: "
+								"the destination dimensions are not compatible with the result." };
+							if (overlap(target, data)) {
+								auto retmat{ std::make_tuple(ncols, nrows, std::valarray<target_value_type>(nrows * ncols)) };
+								transposed(retmat);
+								reshape(target, ncols, nrows, incompatible);
+								map_into(target, retmat, concurrency::degree(policy...), [](const target_value_type& x) { return x; });
+							}
+							else {
+								reshape(target, ncols, nrows, incompatible);
+								transposed(target);
+							}
+						}
+						else {
+							auto retmat{ std::make_tuple(ncols, nrows, std::valarray<data_value_type>(nrows * ncols)) };
+							transposed(retmat);
+							return retmat;
+						}
+					}
+				};
+
+				// in-place transpose of a square mutable dense operand; a rectangular matrix::_ is transposed through
+				// a temporary and swaps its dimensions, other rectangular operands are rejected
+				auto transpose_inplace = [](auto & data, const auto &... policy) {
+					using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+					using traits = dense_traits<data_type>;
+					using data_value_type = typename traits::value_type;
+					if (!real::valued::matrix::integrity_check(data))
+						throw std::runtime_error("Exception from real::valued:matrix::transpose_inplace: "
+							"matrix integrity adjustment is breached.");
+					auto nrows{ std::get<number_of_rows_>(data) };
+					auto ncols{ std::get<number_of_columns_>(data) };
+					if (nrows == ncols)
+						kernel::transpose_square(nrows, concurrency::degree(policy...), traits::pointer(data),
+							traits::row_stride(data), traits::column_stride(data));
+					else if constexpr (std::is_same_v<data_type, _<data_value_type> >)
+						data = transpose(data, policy...);
+					else
+						throw std::runtime_error("Exception from real::valued:matrix::transpose_inplace: "
+							"only square matrices can be transposed in place.");
+				};
+
+				/***********************************************************************/
+				/* real-valued matrix reductions space                                 */
+				/***********************************************************************/
+				namespace reduce {
+
+					// summation option: kahan-compensated lanes, pieces and folds, for accuracy over long sums
+					struct compensated_t {};
+					constexpr compensated_t compensated{};
+
+					template<typename... P>
+					constexpr bool is_compensated_v = (std::is_same_v<std::remove_cv_t<std::remove_reference_t<P> >, compensated_t> || ...);
+
+					// sums over T accumulate in 64-bit integers for integral T, in binary32 for reduced precision, in T otherwise
+					template<typename T>
+					using sum_t = std::conditional_t<std::is_integral_v<T>,
+						std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>, precision::accumulator_t<T> >;
+
+					// means and norms over T are double for integral T, sum_t<T> otherwise
+					template<typename T>
+					using real_t = std::conditional_t<std::is_integral_v<T>, double, sum_t<T> >;
+
+					// orderings of extrema: x replaces y when better(x, y)
+					auto less = [](const auto & x, const auto & y) { return x < y; };
+					auto greater = [](const auto & x, const auto & y) { return y < x; };
+
+					// magnitude of an element
+					auto magnitude = [](const auto & x) {
+						using value_type = std::remove_cv_t<std::remove_reference_t<decltype(x)> >;
+						if constexpr (std::is_unsigned_v<value_type>)
+							return x;
+						else if constexpr (precision::is_reduced_v<value_type>)
+							return std::abs(float(x));
+						else
+							return std::abs(x);
+					};
+
+					// operand checks shared by the reductions
+					auto check = [](const auto & data, std::string_view name, bool nonempty) {
+						using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+						static_assert(dense_traits<data_type>::is_dense, "reductions take dense matrices");
+						if (!dense_traits<data_type>::integrity(data))
+							throw std::runtime_error("Exception from real::valued:matrix::reduce::" + std::string(name) +
+								": matrix integrity adjustment is breached.");
+						if (nonempty && std::get<number_of_rows_>(data) * std::get<number_of_columns_>(data) == 0u)
+							throw std::runtime_error("Exception from real::valued:matrix::reduce::" + std::string(name) +
+								": the matrix is empty.");
+					};
+
+					// reduces an nrows x ncols operand piecewise: contiguous storage in fixed linear chunks through
+					// range(first, last), anything else row by row through row(i); the pieces depend on the shape only,
+					// so folding them in order gives results independent of the number of threads
+					auto pieces = [](size_t nrows, size_t ncols, bool contiguous, auto zero, auto && range, auto && row, size_t threads) {
+						std::vector<decltype(zero)> retvec;
+						if (contiguous) {
+							auto count{ nrows * ncols };
+							auto grain{ concurrency::parallel_grain };
+							retvec.assign((count + grain - 1u) / grain, zero);
+							concurrency::parallel_for(0u, count, grain, threads, [&](size_t first, size_t last) {
+								for (auto piece{ first }; piece < last; piece += grain)
+									retvec[piece / grain] = range(piece, std::min(last, piece + grain));
+							});
+						}
+						else {
+							retvec.assign(nrows, zero);
+							concurrency::parallel_for(0u, nrows, std::max<size_t>(concurrency::parallel_grain / std::max<size_t>(ncols, 1u), 1u), threads,
+								[&](size_t first, size_t last) {
+									for (auto i{ first }; i < last; ++i)
+										retvec[i] = row(i);
+								});
+						}
+						return retvec;
+					};
+
+					// pieces of a single operand, each reduced by run(fn, count) over fn(j) = element j of the piece
+					auto pieces_of = [](const auto & data, auto zero, auto && run, size_t threads) {
+						using traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >;
+						const auto* p{ traits::pointer(data) };
+						auto rs{ traits::row_stride(data) };
+						auto cs{ traits::column_stride(data) };
+						auto ncols{ std::get<number_of_columns_>(data) };
+						return pieces(std::get<number_of_rows_>(data), ncols, cs == 1 && rs == std::ptrdiff_t(ncols), zero,
+							[&](size_t first, size_t last) { return run([q = p + first](size_t j) -> decltype(auto) { return q[j]; }, last - first); },
+							[&](size_t i) { return kernel::with_stride(p + std::ptrdiff_t(i) * rs, cs, [&](auto && fn) { return run(fn, ncols); }); },
+							threads);
+					};
+
+					// sum of the elements
+					auto sum = [](const auto & data, const auto &... option) {
+						using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+						using sum_type = sum_t<value_type>;
+						check(data, "sum", false);
+						auto run = [compensated = is_compensated_v<decltype(option)...>](auto && fn, size_t count) {
+							return kernel::accumulate(count, sum_type(0), compensated, fn);
+						};
+						auto parts{ pieces_of(data, sum_type(0), run, concurrency::degree(option...)) };
+						return run([&parts](size_t k) { return parts[k]; }, parts.size());
+					};
+
+					// mean of the elements
+					auto mean = [](const auto & data, const auto &... option) {
+						using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+						using real_type = real_t<value_type>;
+						return real_type(sum(data, option...)) / real_type(std::get<number_of_rows_>(data) * std::get<number_of_columns_>(data));
+					};
+
+					// extremum of the elements under an ordering
+					auto extremum = [](const auto & data, auto && better, std::string_view name, const auto &... option) {
+						using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+						check(data, name, true);
+						auto run = [&better](auto && fn, size_t count) { return value_type(kernel::extremum(count, fn, better)); };
+						auto parts{ pieces_of(data, value_type(0), run, concurrency::degree(option...)) };
+						return run([&parts](size_t k) { return parts[k]; }, parts.size());
+					};
+
+					// (row, column) of the first extremum in row-major order
+					auto arg_extremum = [](const auto & data, auto && better, std::string_view name, const auto &... option) {
+						using traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >;
+						auto best{ extremum(data, better, name, option...) };
+						const auto* p{ traits::pointer(data) };
+						for (size_t i{ 0u }; i < std::get<number_of_rows_>(data); ++i)
+							for (size_t j{ 0u }; j < std::get<number_of_columns_>(data); ++j)
+								if (!better(best, p[std::ptrdiff_t(i) * traits::row_stride(data) + std::ptrdiff_t(j) * traits::column_stride(data)]) &&
+									!better(p[std::ptrdiff_t(i) * traits::row_stride(data) + std::ptrdiff_t(j) * traits::column_stride(data)], best))
+									return std::make_pair(i, j);
+						return std::make_pair(std::get<number_of_rows_>(data), std::get<number_of_columns_>(data));
+					};
+
+					// smallest and largest elements and their first (row, column) positions
+					auto min = [](const auto & data, const auto &... option) { return extremum(data, less, "min", option...); };
+					auto max = [](const auto & data, const auto &... option) { return extremum(data, greater, "max", option...); };
+					auto argmin = [](const auto & data, const auto &... option) { return arg_extremum(data, less, "argmin", option...); };
+					auto argmax = [](const auto & data, const auto &... option) { return arg_extremum(data, greater, "argmax", option...); };
+
+					// frobenius inner product: sum of the elementwise products of two matrices of the same dimensions
+					auto dot = [](const auto & lhs, const auto & rhs, const auto &... option) {
+						using lhs_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(lhs)> > >;
+						using rhs_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(rhs)> > >;
+						using sum_type = sum_t<std::common_type_t<typename lhs_traits::value_type, typename rhs_traits::value_type> >;
+						check(lhs, "dot", false);
+						check(rhs, "dot", false);
+						if (std::get<number_of_rows_>(lhs) != std::get<number_of_rows_>(rhs) ||
+							std::get<number_of_columns_>(lhs) != std::get<number_of_columns_>(rhs))
+							throw std::runtime_error("Exception from real::valued:matrix::reduce::dot: "
+								"matrices dimensions are not compatible with each other.");
+						const auto* a{ lhs_traits::pointer(lhs) };
+						const auto* b{ rhs_traits::pointer(rhs) };
+						auto rsa{ lhs_traits::row_stride(lhs) };
+						auto csa{ lhs_traits::column_stride(lhs) };
+						auto rsb{ rhs_traits::row_stride(rhs) };
+						auto csb{ rhs_traits::column_stride(rhs) };
+						auto ncols{ std::get<number_of_columns_>(lhs) };
+						auto compensated{ is_compensated_v<decltype(option)...> };
+						auto contiguous{ rsa == std::ptrdiff_t(ncols) && csa == 1 && rsb == std::ptrdiff_t(ncols) && csb == 1 };
+						auto parts{ pieces(std::get<number_of_rows_>(lhs), ncols, contiguous, sum_type(0),
+							[&](size_t first, size_t last) {
+								return kernel::accumulate(last - first, sum_type(0), compensated,
+									[x = a + first, y = b + first](size_t j) { return sum_type(x[j]) * sum_type(y[j]); });
+							},
+							[&](size_t i) {
+								const auto* x{ a + std::ptrdiff_t(i) * rsa };
+								const auto* y{ b + std::ptrdiff_t(i) * rsb };
+								if (csa == 1 && csb == 1)
+									return kernel::accumulate(ncols, sum_type(0), compensated, [x, y](size_t j) { return sum_type(x[j]) * sum_type(y[j]); });
+								return kernel::accumulate(ncols, sum_type(0), compensated,
+									[=](size_t j) { return sum_type(x[std::ptrdiff_t(j) * csa]) * sum_type(y[std::ptrdiff_t(j) * csb]); });
+							},
+							concurrency::degree(option...)) };
+						return kernel::accumulate(parts.size(), sum_type(0), compensated, [&parts](size_t k) { return parts[k]; });
+					};
+
+					// sum of the diagonal elements
+					auto trace = [](const auto & data, const auto &... option) {
+						using traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >;
+						using sum_type = sum_t<typename traits::value_type>;
+						check(data, "trace", false);
+						return kernel::accumulate(std::min(std::get<number_of_rows_>(data), std::get<number_of_columns_>(data)), sum_type(0),
+							is_compensated_v<decltype(option)...>,
+							[p = traits::pointer(data), step = traits::row_stride(data) + traits::column_stride(data)](size_t k) {
+								return p[std::ptrdiff_t(k) * step];
+							});
+					};
+
+					/*******************************************************************/
+					/* per-row reductions space                                        */
+					/*******************************************************************/
+					namespace row {
+
+						// per-row results of run(fn, columns) over fn(j) = element j of the row
+						auto each = [](const auto & data, auto zero, auto && run, size_t threads) {
+							using traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >;
+							const auto* p{ traits::pointer(data) };
+							auto rs{ traits::row_stride(data) };
+							auto cs{ traits::column_stride(data) };
+							auto nrows{ std::get<number_of_rows_>(data) };
+							auto ncols{ std::get<number_of_columns_>(data) };
+							std::valarray<decltype(zero)> retval(zero, nrows);
+							concurrency::parallel_for(0u, nrows, std::max<size_t>(concurrency::parallel_grain / std::max<size_t>(ncols, 1u), 1u), threads,
+								[&](size_t first, size_t last) {
+									for (auto i{ first }; i < last; ++i)
+										retval[i] = kernel::with_stride(p + std::ptrdiff_t(i) * rs, cs, [&](auto && fn) { return run(fn, ncols); });
+								});
+							return retval;
+						};
+
+						// row sums and means
+						auto sum = [](const auto & data, const auto &... option) {
+							using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+							using sum_type = sum_t<value_type>;
+							check(data, "row::sum", false);
+							return each(data, sum_type(0), [compensated = is_compensated_v<decltype(option)...>](auto && fn, size_t count) {
+								return kernel::accumulate(count, sum_type(0), compensated, fn);
+							}, concurrency::degree(option...));
+						};
+
+						auto mean = [](const auto & data, const auto &... option) {
+							using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+							using real_type = real_t<value_type>;
+							auto sums{ sum(data, option...) };
+							std::valarray<real_type> retval(sums.size());
+							for (size_t i{ 0u }; i < sums.size(); ++i)
+								retval[i] = real_type(sums[i]) / real_type(std::get<number_of_columns_>(data));
+							return retval;
+						};
+
+						// row extrema and their first column positions
+						auto extremum = [](const auto & data, auto && better, std::string_view name, const auto &... option) {
+							using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+							check(data, name, true);
+							return each(data, value_type(0), [&better](auto && fn, size_t count) {
+								return value_type(kernel::extremum(count, fn, better));
+							}, concurrency::degree(option...));
+						};
+
+						auto arg_extremum = [](const auto & data, auto && better, std::string_view name, const auto &... option) {
+							check(data, name, true);
+							return each(data, size_t(0u), [&better](auto && fn, size_t count) {
+								auto best{ kernel::extremum(count, fn, better) };
+								size_t j{ 0u };
+								while (better(best, fn(j)) || better(fn(j), best))
+									++j;
+								return j;
+							}, concurrency::degree(option...));
+						};
+
+						auto min = [](const auto & data, const auto &... option) { return extremum(data, less, "row::min", option...); };
+						auto max = [](const auto & data, const auto &... option) { return extremum(data, greater, "row::max", option...); };
+						auto argmin = [](const auto & data, const auto &... option) { return arg_extremum(data, less, "row::argmin", option...); };
+						auto argmax = [](const auto & data, const auto &... option) { return arg_extremum(data, greater, "row::argmax", option...); };
+					}
+
+					/*******************************************************************/
+					/* per-column reductions space                                     */
+					/*******************************************************************/
+					namespace column {
+
+						// column-wise reduction in row-major tiles instead of strided column walks: every (row chunk,
+						// column block) tile is traversed row by row, updating a contiguous run of per-column states with
+						// step(state, x, i); chunk states are then merged per column in chunk order (tiles depend on the
+						// shape only, so results do not depend on the number of threads)
+						auto tiles = [](const auto & data, auto init, auto && step, auto && merge, size_t threads) {
+							using traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >;
+							constexpr size_t block{ 512u };
+							const auto* p{ traits::pointer(data) };
+							auto rs{ traits::row_stride(data) };
+							auto cs{ traits::column_stride(data) };
+							auto nrows{ std::get<number_of_rows_>(data) };
+							auto ncols{ std::get<number_of_columns_>(data) };
+							auto height{ std::max<size_t>(concurrency::parallel_grain / std::max<size_t>(std::min(ncols, block), 1u), 16u) };
+							auto chunks{ (nrows + height - 1u) / height };
+							auto blocks{ (ncols + block - 1u) / block };
+							std::vector<decltype(init)> states(std::max<size_t>(chunks, 1u) * ncols, init);
+							concurrency::parallel_for(0u, chunks * blocks, 1u, threads, [&](size_t first, size_t last) {
+								for (auto tile{ first }; tile < last; ++tile) {
+									auto chunk{ tile / blocks };
+									auto j0{ (tile % blocks) * block };
+									auto j1{ std::min(ncols, j0 + block) };
+									auto* state{ states.data() + chunk * ncols };
+									for (auto i{ chunk * height }; i < std::min(nrows, (chunk + 1u) * height); ++i) {
+										const auto* row{ p + std::ptrdiff_t(i) * rs };
+										if (cs == 1)
+											for (auto j{ j0 }; j < j1; ++j)
+												step(state[j], row[j], i);
+										else
+											for (auto j{ j0 }; j < j1; ++j)
+												step(state[j], row[std::ptrdiff_t(j) * cs], i);
+									}
+								}
+							});
+							for (size_t chunk{ 1u }; chunk < chunks; ++chunk)
+								for (size_t j{ 0u }; j < ncols; ++j)
+									merge(states[j], states[chunk * ncols + j]);
+							states.resize(ncols);
+							return states;
+						};
+
+						// column sums (kahan-compensated per column on request) and means
+						auto sum = [](const auto & data, const auto &... option) {
+							using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+							using sum_type = sum_t<value_type>;
+							check(data, "column::sum", false);
+							auto threads{ concurrency::degree(option...) };
+							std::valarray<sum_type> retval(std::get<number_of_columns_>(data));
+							if constexpr (std::is_floating_point_v<sum_type>) {
+								if (is_compensated_v<decltype(option)...>) {
+									auto add = [](std::pair<sum_type, sum_type> & state, sum_type x) {
+										auto y{ x - state.second };
+										auto t{ state.first + y };
+										state.second = (t - state.first) - y;
+										state.first = t;
+									};
+									auto states{ tiles(data, std::pair<sum_type, sum_type>{}, [&add](auto & state, const auto & x, size_t) { add(state, sum_type(x)); },
+										[&add](auto & state, const auto & other) { add(state, other.first); add(state, -other.second); }, threads) };
+									for (size_t j{ 0u }; j < retval.size(); ++j)
+										retval[j] = states[j].first - states[j].second;
+									return retval;
+								}
+							}
+							auto states{ tiles(data, sum_type(0), [](auto & state, const auto & x, size_t) { state += sum_type(x); },
+								[](auto & state, const auto & other) { state += other; }, threads) };
+							std::copy(states.begin(), states.end(), std::begin(retval));
+							return retval;
+						};
+
+						auto mean = [](const auto & data, const auto &... option) {
+							using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+							using real_type = real_t<value_type>;
+							auto sums{ sum(data, option...) };
+							std::valarray<real_type> retval(sums.size());
+							for (size_t j{ 0u }; j < sums.size(); ++j)
+								retval[j] = real_type(sums[j]) / real_type(std::get<number_of_rows_>(data));
+							return retval;
+						};
+
+						// column extrema with their first row positions, as (value, row) states
+						auto extrema = [](const auto & data, auto && better, std::string_view name, const auto &... option) {
+							using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+							check(data, name, true);
+							constexpr auto unset{ std::numeric_limits<size_t>::max() };
+							return tiles(data, std::make_pair(value_type(0), unset),
+								[&better](auto & state, const auto & x, size_t i) {
+									if (state.second == unset || better(x, state.first))
+										state = { x, i };
+								},
+								[&better](auto & state, const auto & other) {
+									if (other.second != unset && (state.second == unset || better(other.first, state.first)))
+										state = other;
+								}, concurrency::degree(option...));
+						};
+
+						auto extremum = [](const auto & data, auto && better, std::string_view name, const auto &... option) {
+							auto states{ extrema(data, better, name, option...) };
+							std::valarray<typename decltype(states)::value_type::first_type> retval(states.size());
+							for (size_t j{ 0u }; j < states.size(); ++j)
+								retval[j] = states[j].first;
+							return retval;
+						};
+
+						auto arg_extremum = [](const auto & data, auto && better, std::string_view name, const auto &... option) {
+							auto states{ extrema(data, better, name, option...) };
+							std::valarray<size_t> retval(states.size());
+							for (size_t j{ 0u }; j < states.size(); ++j)
+								retval[j] = states[j].second;
+							return retval;
+						};
+
+						auto min = [](const auto & data, const auto &... option) { return extremum(data, less, "column::min", option...); };
+						auto max = [](const auto & data, const auto &... option) { return extremum(data, greater, "column::max", option...); };
+						auto argmin = [](const auto & data, const auto &... option) { return arg_extremum(data, less, "column::argmin", option...); };
+						auto argmax = [](const auto & data, const auto &... option) { return arg_extremum(data, greater, "column::argmax", option...); };
+					}
+
+					/*******************************************************************/
+					/* matrix norms space                                              */
+					/*******************************************************************/
+					namespace norm {
+
+						// frobenius norm: square root of the sum of squared elements
+						auto frobenius = [](const auto & data, const auto &... option) {
+							using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+							using real_type = real_t<value_type>;
+							check(data, "norm::frobenius", false);
+							auto run = [compensated = is_compensated_v<decltype(option)...>](auto && fn, size_t count) {
+								return kernel::accumulate(count, real_type(0), compensated, [&fn](size_t j) { real_type x(fn(j)); return x * x; });
+							};
+							auto parts{ pieces_of(data, real_type(0), run, concurrency::degree(option...)) };
+							return std::sqrt(kernel::accumulate(parts.size(), real_type(0), is_compensated_v<decltype(option)...>,
+								[&parts](size_t k) { return parts[k]; }));
+						};
+
+						// l1 (induced) norm: largest column sum of magnitudes
+						auto l1 = [](const auto & data, const auto &... option) {
+							using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+							using sum_type = sum_t<value_type>;
+							check(data, "norm::l1", false);
+							auto sums{ column::tiles(data, sum_type(0), [](auto & state, const auto & x, size_t) { state += sum_type(magnitude(x)); },
+								[](auto & state, const auto & other) { state += other; }, concurrency::degree(option...)) };
+							return sums.empty() ? sum_type(0) : *std::max_element(sums.begin(), sums.end());
+						};
+
+						// linf (induced) norm: largest row sum of magnitudes
+						auto linf = [](const auto & data, const auto &... option) {
+							using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+							using sum_type = sum_t<value_type>;
+							check(data, "norm::linf", false);
+							auto sums{ row::each(data, sum_type(0), [](auto && fn, size_t count) {
+								return kernel::accumulate(count, sum_type(0), false, [&fn](size_t j) { return sum_type(magnitude(fn(j))); });
+							}, concurrency::degree(option...)) };
+							return sums.size() == 0u ? sum_type(0) : sums.max();
+						};
+					}
+				}
+
+				/***********************************************************************/
+				/* real-valued matrix text serialization space                         */
+				/***********************************************************************/
+				namespace text {
+
+					// field delimiter option: csv (default), tsv or whitespace (any run of blanks when reading)
+					struct delimiter_t {
+						char value;
+					};
+					constexpr delimiter_t csv{ ',' };
+					constexpr delimiter_t tsv{ '\t' };
+					constexpr delimiter_t whitespace{ ' ' };
+
+					// delimiter among the options
+					auto delimiter_of = [](const auto &... option) {
+						char delimiter{ ',' };
+						([&delimiter](const auto & o) {
+							if constexpr (std::is_same_v<std::remove_cv_t<std::remove_reference_t<decltype(o)> >, delimiter_t>)
+								delimiter = o.value;
+						}(option), ...);
+						return delimiter;
+					};
+
+					// upper bound of the characters of one formatted element (shortest round-trip form)
+					constexpr size_t field_width_ = 32u;
+
+					// bytes of text parsed (or rows formatted) per task
+					constexpr size_t chunk_bytes_ = 1u << 20u;
+
+					// shortest text that reads back to the same value; 16-bit floats are formatted as floats
+					auto format = [](char* first, char* last, auto value) {
+						if constexpr (precision::is_reduced_v<decltype(value)>)
+							return std::to_chars(first, last, float(value)).ptr;
+						else
+							return std::to_chars(first, last, value).ptr;
+					};
+
+					// parses one value at first, returning the end of its text (nullptr if there is none)
+					auto scan = [](const char* first, const char* last, auto & value) -> const char* {
+						using value_type = std::remove_reference_t<decltype(value)>;
+						if (first != last && *first == '+')
+							++first;
+						std::from_chars_result result;
+						if constexpr (precision::is_reduced_v<value_type>) {
+							float widened{ 0.0f };
+							result = std::from_chars(first, last, widened);
+							value = value_type(widened);
+						}
+						else
+							result = std::from_chars(first, last, value);
+						return result.ec == std::errc{} ? result.ptr : nullptr;
+					};
+
+					// parses the fields of the line [first, last) into store(k, value) and returns their number;
+					// blanks around delimited fields are skipped
+					template<typename T, typename F>
+					size_t fields(const char* first, const char* last, char delimiter, size_t row, F && store) {
+						auto blank = [delimiter](char c) { return c == ' ' || (c == '\t' && delimiter != '\t'); };
+						auto malformed = [row]() {
+							return std::runtime_error("Exception from real::valued:matrix::text::parse: malformed value in row "
+								+ std::to_string(row) + ".");
+						};
+						size_t count{ 0u };
+						for (;;) {
+							while (first != last && blank(*first))
+								++first;
+							if (first == last && (delimiter == ' ' || count == 0u))
+								return count;
+							T value{};
+							auto* end{ scan(first, last, value) };
+							if (end == nullptr)
+								throw malformed();
+							store(count++, value);
+							first = end;
+							if (delimiter != ' ') {
+								while (first != last && blank(*first))
+									++first;
+								if (first == last)
+									return count;
+								if (*first != delimiter)
+									throw malformed();
+								++first;
+							}
+							else if (first != last && !blank(*first))
+								throw malformed();
+						}
+					}
+
+					// line [first, last) without its carriage return and trailing blanks (empty lines are skipped)
+					auto trim = [](const char* first, const char* last) {
+						while (last != first && (last[-1] == '\r' || last[-1] == ' ' || last[-1] == '\t'))
+							--last;
+						while (first != last && (*first == ' ' || *first == '\t'))
+							++first;
+						return std::make_pair(first, last);
+					};
+
+					// calls fn(line first, line last) for the non-empty lines starting in [begin, end) of [first, last)
+					auto lines = [](const char* first, const char* last, const char* begin, const char* end, auto && fn) {
+						auto* p{ begin };
+						if (p != first && p[-1] != '\n') {
+							p = static_cast<const char*>(std::memchr(p, '\n', size_t(last - p)));
+							p = p == nullptr ? last : p + 1;
+						}
+						while (p < end) {
+							auto* eol{ static_cast<const char*>(std::memchr(p, '\n', size_t(last - p))) };
+							if (eol == nullptr)
+								eol = last;
+							auto [line_first, line_last] { trim(p, eol) };
+							if (line_first != line_last)
+								fn(line_first, line_last);
+							p = eol + 1;
+						}
+					};
+
+					// writes any dense operand as delimited text, one row per line; rows are formatted in parallel
+					// chunks with std::to_chars and written in order without flushing
+					auto write = [](std::ostream & os, const auto & data, const auto &... option) {
+						using traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >;
+						if (!real::valued::matrix::integrity_check(data))
+							throw std::runtime_error("Exception from real::valued:matrix::text::write: "
+								"matrix integrity adjustment is breached.");
+						auto nrows{ std::get<number_of_rows_>(data) };
+						auto ncols{ std::get<number_of_columns_>(data) };
+						auto delimiter{ delimiter_of(option...) };
+						auto threads{ concurrency::degree(option...) };
+						const auto* a{ traits::pointer(data) };
+						auto rsa{ traits::row_stride(data) };
+						auto csa{ traits::column_stride(data) };
+						auto rows_per_chunk{ std::max<size_t>(chunk_bytes_ / (ncols * field_width_ + 1u), 1u) };
+						std::vector<std::string> chunks(4u * threads);
+						for (size_t block{ 0u }; block < nrows; block += rows_per_chunk * chunks.size()) {
+							auto count{ std::min(chunks.size(), (nrows - block + rows_per_chunk - 1u) / rows_per_chunk) };
+							concurrency::parallel_for(0u, count, 1u, threads, [&](size_t first, size_t last) {
+								for (auto c{ first }; c < last; ++c) {
+									auto row_first{ block + c * rows_per_chunk };
+									auto row_last{ std::min(nrows, row_first + rows_per_chunk) };
+									auto& out{ chunks[c] };
+									out.resize((row_last - row_first) * (ncols * field_width_ + 1u));
+									auto* w{ out.data() };
+									for (auto i{ row_first }; i < row_last; ++i) {
+										const auto* row{ a + std::ptrdiff_t(i) * rsa };
+										for (size_t j{ 0u }; j < ncols; ++j) {
+											if (j > 0u)
+												*w++ = delimiter;
+											w = format(w, w + field_width_, row[std::ptrdiff_t(j) * csa]);
+										}
+										*w++ = '\n';
+									}
+									out.resize(size_t(w - out.data()));
+								}
+							});
+							for (size_t c{ 0u }; c < count; ++c)
+								os.write(chunks[c].data(), std::streamsize(chunks[c].size()));
+						}
+						if (!os)
+							throw std::runtime_error("Exception from real::valued:matrix::text::write: cannot write the stream.");
+					};
+
+					// writes any dense operand to a text file
+					auto save = [](std::string_view path, const auto & data, const auto &... option) {
+						std::ofstream os{ std::string(path), std::ios::binary };
+						if (!os)
+							throw std::runtime_error("Exception from real::valued:matrix::text::save: cannot open the file.");
+						write(os, data, option...);
+						os.close();
+						if (!os)
+							throw std::runtime_error("Exception from real::valued:matrix::text::save: cannot write the file.");
+					};
+
+					// parses delimited text into a matrix::_<T>: the line starts of 1 MiB chunks are counted in
+					// parallel, then every chunk parses its own lines into their rows with std::from_chars; empty
+					// lines are skipped and every other line must have the columns of the first one
+					template<typename T>
+					auto parse = [](const char* first, const char* last, const auto &... option) {
+						auto delimiter{ delimiter_of(option...) };
+						auto threads{ concurrency::degree(option...) };
+						auto size{ size_t(last - first) };
+						auto count{ (size + chunk_bytes_ - 1u) / chunk_bytes_ };
+						auto chunk = [first, last](size_t c) {
+							auto begin{ first + c * chunk_bytes_ };
+							return std::make_pair(begin, size_t(last - begin) > chunk_bytes_ ? begin + chunk_bytes_ : last);
+						};
+
+						// columns of the first line
+						size_t ncols{ 0u };
+						bool found{ false };
+						for (auto* p{ first }; p < last && !found;) {
+							auto* eol{ static_cast<const char*>(std::memchr(p, '\n', size_t(last - p))) };
+							if (eol == nullptr)
+								eol = last;
+							auto [line_first, line_last] { trim(p, eol) };
+							if (line_first != line_last) {
+								ncols = fields<T>(line_first, line_last, delimiter, 0u, [](size_t, const T&) {});
+								found = true;
+							}
+							p = eol + 1;
+						}
+
+						// rows starting in each chunk, then the first row of each chunk
+						std::vector<size_t> offsets(count + 1u, 0u);
+						concurrency::parallel_for(0u, count, 1u, threads, [&](size_t c_first, size_t c_last) {
+							for (auto c{ c_first }; c < c_last; ++c) {
+								auto [begin, end] { chunk(c) };
+								lines(first, last, begin, end, [&offsets, c](const char*, const char*) { ++offsets[c + 1u]; });
+							}
+						});
+						std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+						auto nrows{ offsets.back() };
+
+						auto retmat{ std::make_tuple(nrows, ncols, std::valarray<T>(nrows * ncols)) };
+						auto* c{ kernel::pointer(std::get<data_>(retmat)) };
+						concurrency::parallel_for(0u, count, 1u, threads, [&](size_t c_first, size_t c_last) {
+							for (auto k{ c_first }; k < c_last; ++k) {
+								auto [begin, end] { chunk(k) };
+								auto i{ offsets[k] };
+								lines(first, last, begin, end, [&i, c, ncols, delimiter](const char* line_first, const char* line_last) {
+									auto* row{ c + i * ncols };
+									if (fields<T>(line_first, line_last, delimiter, i, [row, ncols](size_t j, const T & value) {
+										if (j < ncols)
+											row[j] = value;
+									}) != ncols)
+										throw std::runtime_error("Exception from real::valued:matrix::text::parse: row "
+											+ std::to_string(i) + " does not have " + std::to_string(ncols) + " columns.");
+									++i;
+								});
+							}
+						});
+						return retmat;
+					};
+
+					// reads a whole stream of delimited text into a matrix::_<T>
+					template<typename T>
+					auto read = [](std::istream & is, const auto &... option) {
+						std::string contents{ std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>() };
+						return parse<T>(contents.data(), contents.data() + contents.size(), option...);
+					};
+
+					// reads a text file into a matrix::_<T>, parsing the memory-mapped file in place
+					template<typename T>
+					auto load = [](std::string_view path, const auto &... option) {
+						memory::mapping file{ path, false };
+						const auto* first{ reinterpret_cast<const char*>(file.data()) };
+						return parse<T>(first, first + file.size(), option...);
+					};
+				}
+
+				/***********************************************************************/
+				/* real-valued matrix lazy expressions space                           */
+				/***********************************************************************/
+				namespace lazy {
+
+					// common base of expression nodes
+					struct expression {};
+
+					// expression node trait
+					template<typename E>
+					constexpr bool is_expression_v = std::is_base_of_v<expression, std::remove_cv_t<std::remove_reference_t<E> > >;
+
+					// leaf node reading a real-valued matrix (shares ownership when built from a temporary)
+					template<typename T>
+					struct terminal : expression {
+						using value_type = T;
+						static constexpr bool broadcast = false;
+						size_t number_of_rows;
+						size_t number_of_columns;
+						const T* data;
+						std::shared_ptr<const real::valued::matrix::_<T> > owner;
+						value_type operator[](size_t k) const { return data[k]; }
+					};
+
+					// leaf node broadcasting a scalar over the shape of the other operand
+					template<typename T>
+					struct scalar : expression {
+						using value_type = T;
+						static constexpr bool broadcast = true;
+						size_t number_of_rows;
+						size_t number_of_columns;
+						T value;
+						value_type operator[](size_t) const { return value; }
+					};
+
+					// elementwise unary node: fn(operand)
+					template<typename E, typename Fn>
+					struct unary : expression {
+						using value_type = typename E::value_type;
+						static constexpr bool broadcast = E::broadcast;
+						size_t number_of_rows;
+						size_t number_of_columns;
+						E operand;
+						Fn fn;
+						value_type operator[](size_t k) const { return value_type(fn(operand[k])); }
+					};
+
+					// elementwise binary node: op(lhs, rhs) computed in the common value type
+					template<typename L, typename R, typename Op>
+					struct binary : expression {
+						using value_type = std::common_type_t<typename L::value_type, typename R::value_type>;
+						static constexpr bool broadcast = false;
+						size_t number_of_rows;
+						size_t number_of_columns;
+						L lhs;
+						R rhs;
+						Op op;
+						value_type operator[](size_t k) const { return op(value_type(lhs[k]), value_type(rhs[k])); }
+					};
+
+					// wraps a real-valued matrix, an arithmetic scalar or an expression as an expression node
+					auto operand = [](auto && x) {
+						using x_type = std::remove_cv_t<std::remove_reference_t<decltype(x)> >;
+						if constexpr (is_expression_v<x_type>)
+							return x_type(std::forward<decltype(x)>(x));
+						else if constexpr (std::is_arithmetic_v<x_type>)
+							return scalar<x_type>{ {}, 0u, 0u, x };
+						else {
+							using value_type = typename std::tuple_element_t<data_, x_type>::value_type;
+							if constexpr (std::is_same_v<x_type, real::valued::matrix::_<value_type> >) {
+								if (!real::valued::matrix::integrity_check(x))
+									throw std::runtime_error("Exception from real::valued:matrix::lazy::operand: "
+										"matrix integrity adjustment is breached.");
+								if constexpr (std::is_lvalue_reference_v<decltype(x)>)
+									return terminal<value_type>{ {},
+										std::get<number_of_rows_>(x),
+										std::get<number_of_columns_>(x),
+										kernel::pointer(std::get<data_>(x)),
+										nullptr };
+								else {
+									auto owner{ std::make_shared<const real::valued::matrix::_<value_type> >(std::move(x)) };
+									return terminal<value_type>{ {},
+										std::get<number_of_rows_>(*owner),
+										std::get<number_of_columns_>(*owner),
+										kernel::pointer(std::get<data_>(*owner)),
+										owner };
+								}
+							}
+						}
+					};
+
+					// shape-checked elementwise binary node (scalars take the shape of the other operand)
+					auto combine = [](auto && lhs, auto && rhs, auto op) {
+						auto l{ operand(std::forward<decltype(lhs)>(lhs)) };
+						auto r{ operand(std::forward<decltype(rhs)>(rhs)) };
+						using l_type = decltype(l);
+						using r_type = decltype(r);
+						static_assert(!(l_type::broadcast && r_type::broadcast), "at least one operand must be a matrix or a matrix expression");
+						auto shape{ l_type::broadcast ? std::make_pair(r.number_of_rows, r.number_of_columns) : std::make_pair(l.number_of_rows, l.number_of_columns) };
+						if (!l_type::broadcast && !r_type::broadcast &&
+							(l.number_of_rows != r.number_of_rows || l.number_of_columns != r.number_of_columns))
+							throw std::runtime_error("Exception from real::valued:matrix::lazy: "
+								"matrices dimensions are not compatible with each other.");
+						return binary<l_type, r_type, decltype(op)>{ {}, shape.first, shape.second, std::move(l), std::move(r), op };
+					};
+
+					// lazy elementwise addition
+					auto addition = [](auto && lhs, auto && rhs) {
+						return combine(std::forward<decltype(lhs)>(lhs), std::forward<decltype(rhs)>(rhs), std::plus<>());
+					};
+
+					// lazy elementwise subtraction
+					auto subtraction = [](auto && lhs, auto && rhs) {
+						return combine(std::forward<decltype(lhs)>(lhs), std::forward<decltype(rhs)>(rhs), std::minus<>());
+					};
+
+					// lazy scaling by a scalar
+					auto scale = [](auto && x, auto factor) {
+						static_assert(std::is_arithmetic_v<decltype(factor)>, "scale factor must be arithmetic");
+						return combine(std::forward<decltype(x)>(x), factor, std::multiplies<>());
+					};
+
+					// lazy elementwise function application
+					auto apply = [](auto && x, auto && fn) {
+						auto e{ operand(std::forward<decltype(x)>(x)) };
+						using fn_type = std::decay_t<decltype(fn)>;
+						static_assert(std::is_invocable_v<const fn_type&, typename decltype(e)::value_type>,
+							"fn must be invocable with the expression value type");
+						auto rows{ e.number_of_rows };
+						auto columns{ e.number_of_columns };
+						return unary<decltype(e), fn_type>{ {}, rows, columns, std::move(e), std::forward<decltype(fn)>(fn) };
+					};
+
+					// evaluates an expression into a newly allocated matrix in a single fused pass
+					auto evaluate = [](auto && x, const auto &... policy) {
+						auto e{ operand(std::forward<decltype(x)>(x)) };
+						using value_type = typename decltype(e)::value_type;
+						auto retmat{ std::make_tuple(e.number_of_rows,
+							e.number_of_columns,
+							std::valarray<value_type>(e.number_of_rows * e.number_of_columns)) };
+						auto* out{ kernel::pointer(std::get<data_>(retmat)) };
+						concurrency::parallel_for(0u, std::get<data_>(retmat).size(), concurrency::parallel_grain,
+							concurrency::degree(policy...), [&e, out](size_t first, size_t last) {
+								for (auto k{ first }; k < last; ++k)
+									out[k] = e[k];
+							});
+						return retmat;
+					};
+
+					// evaluates an expression into an existing matrix without allocating when the shapes agree;
+					// the destination may also appear in the expression since every node is elementwise
+					auto assign = [](auto & destination, auto && x, const auto &... policy) {
+						using data_type = std::remove_reference_t<decltype(destination)>;
+						using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
+						if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
+							auto e{ operand(std::forward<decltype(x)>(x)) };
+							auto size{ e.number_of_rows * e.number_of_columns };
+							if (std::get<data_>(destination).size() != size)
+								std::get<data_>(destination).resize(size);
+							std::get<number_of_rows_>(destination) = e.number_of_rows;
+							std::get<number_of_columns_>(destination) = e.number_of_columns;
+							auto* out{ kernel::pointer(std::get<data_>(destination)) };
+							concurrency::parallel_for(0u, size, concurrency::parallel_grain,
+								concurrency::degree(policy...), [&e, out](size_t first, size_t last) {
+									for (auto k{ first }; k < last; ++k)
+										out[k] = data_value_type(e[k]);
+								});
+						}
+					};
+
+					// real-valued matrix trait
+					template<typename X>
+					struct is_matrix : std::false_type {};
+
+					template<typename T>
+					struct is_matrix<std::tuple<size_t, size_t, std::valarray<T> > > : std::is_arithmetic<T> {};
+
+					// operand accepted next to an expression in an operator
+					template<typename X>
+					constexpr bool is_operand_v = is_expression_v<X> || std::is_arithmetic_v<std::remove_cv_t<std::remove_reference_t<X> > > ||
+						is_matrix<std::remove_cv_t<std::remove_reference_t<X> > >::value;
+
+					// expression operators (found by argument-dependent lookup on expression nodes)
+					template<typename L, typename R, typename = std::enable_if_t<(is_expression_v<L> || is_expression_v<R>) && is_operand_v<L> && is_operand_v<R> > >
+					auto operator+(L && lhs, R && rhs) { return addition(std::forward<L>(lhs), std::forward<R>(rhs)); }
+
+					template<typename L, typename R, typename = std::enable_if_t<(is_expression_v<L> || is_expression_v<R>) && is_operand_v<L> && is_operand_v<R> > >
+					auto operator-(L && lhs, R && rhs) { return subtraction(std::forward<L>(lhs), std::forward<R>(rhs)); }
+
+					template<typename E, typename S, typename = std::enable_if_t<is_expression_v<E> && std::is_arithmetic_v<S> > >
+					auto operator*(E && e, S factor) { return scale(std::forward<E>(e), factor); }
+
+					template<typename E, typename S, typename = std::enable_if_t<is_expression_v<E> && std::is_arithmetic_v<S> > >
+					auto operator*(S factor, E && e) { return scale(std::forward<E>(e), factor); }
+
+					template<typename E, typename S, typename = std::enable_if_t<is_expression_v<E> && std::is_arithmetic_v<S> > >
+					auto operator/(E && e, S divisor) { return combine(std::forward<E>(e), divisor, std::divides<>()); }
+
+					template<typename E, typename = std::enable_if_t<is_expression_v<E> > >
+					auto operator-(E && e) { return apply(std::forward<E>(e), std::negate<>()); }
+				}
+
+				/***********************************************************************/
+				/* real-valued matrix aligned storage space                            */
+				/***********************************************************************/
+				namespace aligned {
+
+					// real-valued matrix on 64-byte aligned, resource-allocated storage with a leading dimension;
+					// shares the (rows, columns, data) protocol of matrix::_ and adds the row stride as a fourth field
+					template<typename T>
+					using _ = std::enable_if_t<std::is_arithmetic_v<T>, std::tuple<size_t, size_t, memory::buffer<T>, size_t> >;
+
+					// aligned matrix protocol (extends the generic matrix protocols)
+					constexpr size_t leading_dimension_ = row_stride_;
+
+					// option padding every row to a multiple of the storage alignment
+					struct padded_t {};
+					constexpr padded_t padded{};
+
+					// options of the aligned constructors: a std::pmr::memory_resource* and/or padded
+					auto options = [](const auto &... option) {
+						std::pair<std::pmr::memory_resource*, bool> retopt{ std::pmr::get_default_resource(), false };
+						([&retopt](const auto & o) {
+							using option_type = std::remove_cv_t<std::remove_reference_t<decltype(o)> >;
+							if constexpr (std::is_same_v<option_type, padded_t>)
+								retopt.second = true;
+							else if constexpr (std::is_convertible_v<option_type, std::pmr::memory_resource*>)
+								retopt.first = o;
+						}(option), ...);
+						return retopt;
+					};
+
+					// row stride of a matrix with `number_of_columns` elements of `element_size` bytes per row
+					auto leading_dimension = [](size_t number_of_columns, size_t element_size, bool is_padded) {
+						auto lanes{ std::max<size_t>(memory::alignment_ / element_size, 1u) };
+						return is_padded ? ((number_of_columns + lanes - 1u) / lanes) * lanes : number_of_columns;
+					};
+
+					// allocates an uninitialized aligned matrix (padding elements are zeroed)
+					auto allocate = [](size_t number_of_rows, size_t number_of_columns, auto value, bool is_padded, std::pmr::memory_resource* resource) {
+						using value_type = decltype(value);
+						auto ld{ leading_dimension(number_of_columns, sizeof(value_type), is_padded) };
+						auto retmat{ std::make_tuple(number_of_rows,
+							number_of_columns,
+							memory::buffer<value_type>(number_of_rows * ld, memory::uninitialized, resource),
+							ld) };
+						if (ld != number_of_columns)
+							for (size_t i{ 0u }; i < number_of_rows; ++i)
+								std::fill(&std::get<data_>(retmat)[i * ld + number_of_columns], &std::get<data_>(retmat)[i * ld] + ld, value_type(0));
+						return retmat;
+					};
+
+					// aligned matrix constructor (same data forms as matrix::constructor, plus allocation options)
+					auto constructor = [](size_t number_of_rows, size_t number_of_columns, const auto & data, const auto &... option) {
+						using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+						auto [resource, is_padded] { options(option...) };
+						if constexpr (std::is_arithmetic_v<data_type>) {
+							auto retmat{ allocate(number_of_rows, number_of_columns, data_type(0), is_padded, resource) };
+							for (size_t i{ 0u }; i < number_of_rows; ++i)
+								std::fill_n(&std::get<data_>(retmat)[i * std::get<leading_dimension_>(retmat)], number_of_columns, data);
+							return retmat;
+						}
+						else {
+							using data_value_type = typename data_type::value_type;
+							auto retmat{ allocate(number_of_rows, number_of_columns, data_value_type(0), is_padded, resource) };
+							std::fill(std::get<data_>(retmat).begin(), std::get<data_>(retmat).end(), data_value_type(0));
+							auto minsize{ std::min(std::size(data), number_of_rows * number_of_columns) };
+							auto it = std::begin(data);
+							for (size_t k{ 0u }; k < minsize; ++k, it = std::next(it))
+								std::get<data_>(retmat)[(k / number_of_columns) * std::get<leading_dimension_>(retmat) + k % number_of_columns] = *it;
+							return retmat;
+						}
+					};
+
+					// aligned matrix generator (allocates from the default memory resource)
+					auto generator = [](size_t number_of_rows, size_t number_of_columns, auto && fn, auto... args) {
+						using fn_type = std::remove_reference_t<decltype(fn)>;
+						if constexpr (std::is_invocable_v<fn_type, decltype(args)...>) {
+							using return_type = std::invoke_result_t<fn_type, decltype(args)...>;
+							auto retmat{ allocate(number_of_rows, number_of_columns, return_type(0), false, std::pmr::get_default_resource()) };
+							for (auto& elem : std::get<data_>(retmat))
+								elem = fn(args...);
+							return retmat;
+						}
+					};
+
+					// aligned matrix integrity check
+					auto integrity_check = [](const auto & data) {
+						using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+						using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
+						if constexpr (std::is_same_v<data_type, _<data_value_type> >)
+							return std::get<leading_dimension_>(data) >= std::get<number_of_columns_>(data) &&
+								std::get<number_of_rows_>(data) * std::get<leading_dimension_>(data) == std::get<data_>(data).size();
+						else return false;
+					};
+
+					// conversion from a valarray-backed matrix (migration path from matrix::_)
+					auto from_matrix = [](const auto & mat, const auto &... option) {
+						return constructor(std::get<number_of_rows_>(mat), std::get<number_of_columns_>(mat), std::get<data_>(mat), option...);
+					};
+
+					// conversion back to a valarray-backed matrix
+					auto to_matrix = [](const auto & mat) {
+						using data_value_type = typename std::tuple_element_t<data_, std::remove_cv_t<std::remove_reference_t<decltype(mat)> > >::value_type;
+						auto nrows{ std::get<number_of_rows_>(mat) };
+						auto ncols{ std::get<number_of_columns_>(mat) };
+						auto retmat{ std::make_tuple(nrows, ncols, std::valarray<data_value_type>(nrows * ncols)) };
+						for (size_t i{ 0u }; i < nrows; ++i)
+							std::copy_n(&std::get<data_>(mat)[i * std::get<leading_dimension_>(mat)], ncols, &std::get<data_>(retmat)[i * ncols]);
+						return retmat;
+					};
+
+					// aligned matrix display
+					auto display = [](std::string_view title, const auto & data) {
+						if (integrity_check(data))
+							real::valued::matrix::display(title, to_matrix(data));
+					};
+
+					// row-parallel elementwise kernel: fn(i, first_column, last_column) over every row
+					auto for_each_row = [](size_t number_of_rows, size_t number_of_columns, size_t threads, auto && fn) {
+						auto grain{ std::max<size_t>(concurrency::parallel_grain / std::max<size_t>(number_of_columns, 1u), 1u) };
+						concurrency::parallel_for(0u, number_of_rows, grain, threads, [&fn, number_of_columns](size_t first, size_t last) {
+							for (auto i{ first }; i < last; ++i)
+								fn(i, number_of_columns);
+						});
+					};
+
+					// aligned matrix apply function (result allocated from the operand's resource)
+					auto apply = [](const auto & data, auto && fn, const auto &... policy) {
+						using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+						using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
+						if constexpr (std::is_same_v<data_type, _<data_value_type> >) {
+							auto ld{ std::get<leading_dimension_>(data) };
+							auto retmat{ allocate(std::get<number_of_rows_>(data), std::get<number_of_columns_>(data), data_value_type(0),
+								ld != std::get<number_of_columns_>(data), std::get<data_>(data).resource()) };
+							const auto* in{ std::get<data_>(data).data() };
+							auto* out{ std::get<data_>(retmat).data() };
+							auto ldc{ std::get<leading_dimension_>(retmat) };
+							for_each_row(std::get<number_of_rows_>(data), std::get<number_of_columns_>(data), concurrency::degree(policy...),
+								[&fn, in, out, ld, ldc](size_t i, size_t ncols) {
+									for (size_t j{ 0u }; j < ncols; ++j)
+										out[i * ldc + j] = data_value_type(fn(in[i * ld + j]));
+								});
+							return retmat;
+						}
+					};
+
+					// aligned matrix elementwise binary operation shared by addition and subtraction
+					auto elementwise = [](const auto & lhs, const auto & rhs, auto op, const char* incompatible, const char* breached, size_t threads) {
+						using lhs_type = std::remove_cv_t<std::remove_reference_t<decltype(lhs)> >;
+						using lhs_value_type = typename std::tuple_element_t<data_, lhs_type>::value_type;
+						if (!integrity_check(lhs) || !integrity_check(rhs))
+							throw std::runtime_error(breached);
+						if ((std::get<number_of_rows_>(lhs) != std::get<number_of_rows_>(rhs)) ||
+							(std::get<number_of_columns_>(lhs) != std::get<number_of_columns_>(rhs)))
+							throw std::runtime_error(incompatible);
+						auto lda{ std::get<leading_dimension_>(lhs) };
+						auto ldb{ std::get<leading_dimension_>(rhs) };
+						auto retmat{ allocate(std::get<number_of_rows_>(lhs), std::get<number_of_columns_>(lhs), lhs_value_type(0),
+							lda != std::get<number_of_columns_>(lhs), std::get<data_>(lhs).resource()) };
+						auto ldc{ std::get<leading_dimension_>(retmat) };
+						const auto* a{ std::get<data_>(lhs).data() };
+						const auto* b{ std::get<data_>(rhs).data() };
+						auto* c{ std::get<data_>(retmat).data() };
+						for_each_row(std::get<number_of_rows_>(lhs), std::get<number_of_columns_>(lhs), threads,
+							[a, b, c, lda, ldb, ldc, op](size_t i, size_t ncols) {
+								for (size_t j{ 0u }; j < ncols; ++j)
+									c[i * ldc + j] = lhs_value_type(op(a[i * lda + j], b[i * ldb + j]));
+							});
+						return retmat;
+					};
+
+					// aligned matrix addition function
+					auto addition = [](const auto & lhs, const auto & rhs, const auto &... policy) {
+						return elementwise(lhs, rhs, std::plus<>(),
+							"Exception from real::valued:matrix::aligned::addition: "
+							"matrices dimensions are not compatible with each other.",
+							"Exception from real::valued:matrix::aligned::addition: "
+							"matrix integrity adjustment is breached.",
+							concurrency::degree(policy...));
+					};
+
+					// aligned matrix subtraction function
+					auto subtraction = [](const auto & lhs, const auto & rhs, const auto &... policy) {
+						return elementwise(lhs, rhs, std::minus<>(),
+							"Exception from real::valued:matrix::aligned::subtraction: "
+							"matrices dimensions are not compatible with each other.",
+							"Exception from real::valued:matrix::aligned::subtraction: "
+							"matrix integrity adjustment is breached.",
+							concurrency::degree(policy...));
+					};
+
+					// aligned matrix multiplication function (result allocated from the lhs resource)
+					auto multiplication = [](const auto & lhs, const auto & rhs, const auto &... policy) {
+						using lhs_type = std::remove_cv_t<std::remove_reference_t<decltype(lhs)> >;
+						using lhs_value_type = typename std::tuple_element_t<data_, lhs_type>::value_type;
+						using rhs_type = std::remove_cv_t<std::remove_reference_t<decltype(rhs)> >;
+						using rhs_value_type = typename std::tuple_element_t<data_, rhs_type>::value_type;
+						using return_value_type = std::common_type_t<lhs_value_type, rhs_value_type>;
+
+						if (!integrity_check(lhs) || !integrity_check(rhs))
+							throw std::runtime_error("Exception from real::valued:matrix::aligned::multiplication: "
+								"matrix integrity adjustment is breached.");
+						if (std::get<number_of_columns_>(lhs) != std::get<number_of_rows_>(rhs))
+							throw std::runtime_error("Exception from real::valued:matrix::aligned::multiplication: "
+								"matrices dimensions are not compatible for matrix multiplication.");
+
+						auto nrows{ std::get<number_of_rows_>(lhs) };
+						auto ncols{ std::get<number_of_columns_>(rhs) };
+						auto retmat{ allocate(nrows, ncols, return_value_type(0),
+							std::get<leading_dimension_>(lhs) != std::get<number_of_columns_>(lhs), std::get<data_>(lhs).resource()) };
+						kernel::gemm(nrows, ncols, std::get<number_of_columns_>(lhs),
+							return_value_type(1), std::get<data_>(lhs).data(), std::ptrdiff_t(std::get<leading_dimension_>(lhs)), std::ptrdiff_t(1),
+							std::get<data_>(rhs).data(), std::ptrdiff_t(std::get<leading_dimension_>(rhs)), std::ptrdiff_t(1),
+							return_value_type(0), std::get<data_>(retmat).data(), std::get<leading_dimension_>(retmat),
+							concurrency::degree(policy...));
+						return retmat;
+					};
+				}
+
+				/***********************************************************************/
+				/* real-valued memory-mapped matrix space                              */
+				/***********************************************************************/
+				namespace mapped {
+
+					// real-valued matrix backed by a memory-mapped file: (rows, columns, region, row stride); shares
+					// the protocols of aligned::_, so every dense operation takes it without copying. T is
+					// const-qualified for read-only files, which then cannot be a destination
+					template<typename T>
+					using _ = std::enable_if_t<std::is_arithmetic_v<T>, std::tuple<size_t, size_t, memory::region<T>, size_t> >;
+
+					// on-disk layout: this 64-byte header, then rows x stride elements in native byte order
+					struct header {
+						char magic[4];				// "HPMX"
+						std::uint32_t version;		// format version
+						std::uint32_t type;			// element type code
+						std::uint32_t reserved0;
+						std::uint64_t rows;
+						std::uint64_t columns;
+						std::uint64_t stride;		// elements between the first elements of consecutive rows
+						std::uint64_t offset;		// byte offset of the first element
+						std::uint8_t reserved1[16];
+					};
+					static_assert(sizeof(header) == memory::alignment_, "the header keeps the elements cache-line aligned");
+
+					// current format version
+					constexpr std::uint32_t version_ = 1u;
+
+					// element type code: kind ('f'loating, 's'igned, 'u'nsigned) in the second byte, size in the first
+					template<typename T>
+					constexpr std::uint32_t type_code = (std::uint32_t(std::is_floating_point_v<T> ? 'f' : std::is_signed_v<T> ? 's' : 'u') << 8u) |
+						std::uint32_t(sizeof(T));
+
+					// option opening a matrix file read-write
+					struct writable_t {};
+					constexpr writable_t writable{};
+
+					// option bounding the resident working set of the out-of-core operations, in bytes
+					struct budget {
+						size_t bytes{ size_t(256u) << 20u };
+					};
+
+					// working-set budget among the options (256 MiB by default)
+					auto working_set = [](const auto &... option) {
+						size_t bytes{ budget{}.bytes };
+						([&bytes](const auto & o) {
+							if constexpr (std::is_same_v<std::remove_cv_t<std::remove_reference_t<decltype(o)> >, budget>)
+								bytes = std::max<size_t>(o.bytes, 1u);
+						}(option), ...);
+						return bytes;
+					};
+
+					// memory-mapped matrix trait
+					template<typename X>
+					struct is_mapped : std::false_type {};
+
+					template<typename T>
+					struct is_mapped<std::tuple<size_t, size_t, memory::region<T>, size_t> > : std::true_type {};
+
+					// creates a zero-filled matrix file mapped read-write (rows padded to the storage alignment
+					// with aligned::padded)
+					template<typename T>
+					auto create = [](std::string_view path, size_t number_of_rows, size_t number_of_columns, const auto &... option) {
+						auto ld{ aligned::leading_dimension(number_of_columns, sizeof(T), aligned::options(option...).second) };
+						if (ld != 0u && number_of_rows > (std::numeric_limits<size_t>::max() - sizeof(header)) / sizeof(T) / ld)
+							throw std::runtime_error("Exception from real::valued:matrix::mapped::create: "
+								"the matrix size is too large.");
+						auto file{ std::make_shared<memory::mapping>(path, true, sizeof(header) + number_of_rows * ld * sizeof(T)) };
+						header h{ { 'H', 'P', 'M', 'X' }, version_, type_code<T>, 0u, number_of_rows, number_of_columns, ld, sizeof(header), {} };
+						std::memcpy(file->data(), &h, sizeof(header));
+						return std::make_tuple(number_of_rows, number_of_columns, memory::region<T>(std::move(file), sizeof(header), number_of_rows * ld), ld);
+					};
+
+					// opens a matrix file as a zero-copy matrix: mapped::_<const T> unless `writable` is given, so
+					// writes into a read-only mapping do not compile; the header must match the element type
+					template<typename T>
+					auto open = [](std::string_view path, const auto &... option) {
+						constexpr bool is_writable{ (std::is_same_v<std::remove_cv_t<std::remove_reference_t<decltype(option)> >, writable_t> || ...) };
+						auto file{ std::make_shared<memory::mapping>(path, is_writable) };
+						header h{};
+						if (file->size() < sizeof(header))
+							throw std::runtime_error("Exception from real::valued:matrix::mapped::open: "
+								"the file is not a matrix file.");
+						std::memcpy(&h, file->data(), sizeof(header));
+						if (std::memcmp(h.magic, "HPMX", 4u) != 0 || h.version != version_)
+							throw std::runtime_error("Exception from real::valued:matrix::mapped::open: "
+								"the file is not a matrix file.");
+						if (h.type != type_code<T>)
+							throw std::runtime_error("Exception from real::valued:matrix::mapped::open: "
+								"the stored element type does not match.");
+						// bounds are checked by division so that crafted sizes cannot wrap around; a matrix without rows
+						// or columns has an empty region, so only rows of a nonzero stride need to fit in the file
+						auto room{ h.offset <= file->size() ? (file->size() - h.offset) / sizeof(T) : 0u };
+						if (h.stride < h.columns || h.offset < sizeof(header) || h.offset > file->size() || h.offset % alignof(T) != 0u ||
+							(h.rows != 0u && h.stride != 0u && (h.stride > room || h.rows > room / h.stride)))
+							throw std::runtime_error("Exception from real::valued:matrix::mapped::open: "
+								"matrix integrity adjustment is breached.");
+						auto nrows{ size_t(h.rows) };
+						auto ld{ size_t(h.stride) };
+						using element_type = std::conditional_t<is_writable, T, const T>;
+						return std::make_tuple(nrows, size_t(h.columns), memory::region<element_type>(std::move(file), size_t(h.offset), nrows * ld), ld);
+					};
+
+					// mapped matrix integrity check
+					auto integrity_check = [](const auto & data) {
+						if constexpr (is_mapped<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value)
+							return std::get<row_stride_>(data) >= std::get<number_of_columns_>(data) &&
+								std::get<number_of_rows_>(data) * std::get<row_stride_>(data) == std::get<data_>(data).size();
+						else return false;
+					};
+
+					// writes any dense operand (matrix, aligned, view, mapped) to a matrix file and returns it mapped
+					auto save = [](std::string_view path, const auto & mat, const auto &... option) {
+						using mat_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(mat)> > >;
+						using value_type = typename mat_traits::value_type;
+						if (!real::valued::matrix::integrity_check(mat))
+							throw std::runtime_error("Exception from real::valued:matrix::mapped::save: "
+								"matrix integrity adjustment is breached.");
+						auto retmat{ create<value_type>(path, std::get<number_of_rows_>(mat), std::get<number_of_columns_>(mat), option...) };
+						kernel::map(std::get<number_of_rows_>(mat), std::get<number_of_columns_>(mat), concurrency::degree(option...),
+							std::get<data_>(retmat).data(), std::get<row_stride_>(retmat),
+							mat_traits::pointer(mat), mat_traits::row_stride(mat), mat_traits::column_stride(mat),
+							[](const auto & x) { return x; });
+						return retmat;
+					};
+
+					// writes modified pages of a mapped matrix back to its file
+					auto flush = [](const auto & mat) {
+						std::get<data_>(mat).file()->flush();
+					};
+
+					// read-ahead (`prefetch`) or eviction (`!prefetch`) hint for rows [first, last) of a mapped
+					// operand; other operands are already resident and ignore it
+					auto advise = [](const auto & mat, size_t first, size_t last, bool prefetch) {
+						using mat_type = std::remove_cv_t<std::remove_reference_t<decltype(mat)> >;
+						if constexpr (is_mapped<mat_type>::value) {
+							using value_type = typename std::tuple_element_t<data_, mat_type>::value_type;
+							const auto& region{ std::get<data_>(mat) };
+							auto ld{ std::get<row_stride_>(mat) };
+							auto offset{ region.offset() + first * ld * sizeof(value_type) };
+							auto bytes{ (last - first) * ld * sizeof(value_type) };
+							if (prefetch)
+								region.file()->prefetch(offset, bytes);
+							else
+								region.file()->evict(offset, bytes);
+						}
+					};
+
+					// conversion to a valarray-backed matrix
+					auto to_matrix = [](const auto & mat) {
+						return aligned::to_matrix(mat);
+					};
+
+					// mapped matrix display
+					auto display = [](std::string_view title, const auto & data) {
+						if (integrity_check(data))
+							real::valued::matrix::display(title, to_matrix(data));
+					};
+
+					// out-of-core multiplication into a new matrix file at `path`. A dedicated I/O thread stages the
+					// next (lhs, rhs) tile pair into a double buffer while the current pair is multiplied; operand rows
+					// are evicted after their last tile and result rows once written. Tiles are sized so the buffers
+					// fit the budget option. Execution policies parallelize each tile product.
+					auto multiplication = [](std::string_view path, const auto & lhs, const auto & rhs, const auto &... option) {
+						using lhs_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(lhs)> > >;
+						using rhs_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(rhs)> > >;
+						using value_type = std::common_type_t<typename lhs_traits::value_type, typename rhs_traits::value_type>;
+						if (!real::valued::matrix::integrity_check(lhs) || !real::valued::matrix::integrity_check(rhs))
+							throw std::runtime_error("Exception from real::valued:matrix::mapped::multiplication: "
+								"matrix integrity adjustment is breached.");
+						if (std::get<number_of_columns_>(lhs) != std::get<number_of_rows_>(rhs))
+							throw std::runtime_error("Exception from real::valued:matrix::mapped::multiplication: "
+								"matrices dimensions are not compatible for matrix multiplication.");
+
+						auto m{ std::get<number_of_rows_>(lhs) };
+						auto k{ std::get<number_of_columns_>(lhs) };
+						auto n{ std::get<number_of_columns_>(rhs) };
+						auto threads{ concurrency::degree(option...) };
+						auto retmat{ create<value_type>(path, m, n, option...) };
+						auto ldc{ std::get<row_stride_>(retmat) };
+						auto* c{ std::get<data_>(retmat).data() };
+
+						// two (lhs, rhs) tile pairs and one result tile: 5 t^2 elements within the budget
+						auto tile{ size_t(std::sqrt(double(working_set(option...)) / (5.0 * sizeof(value_type)))) };
+						tile = std::max<size_t>(tile / 64u * 64u, 64u);
+						auto mt{ std::min(tile, m) }, kt{ std::min(tile, k) }, nt{ std::min(tile, n) };
+						auto mtiles{ mt > 0u ? (m + mt - 1u) / mt : 0u };
+						auto ktiles{ kt > 0u ? (k + kt - 1u) / kt : 0u };
+						auto ntiles{ nt > 0u ? (n + nt - 1u) / nt : 0u };
+						auto count{ mtiles * ntiles * ktiles };
+
+						memory::buffer<value_type> lhs_tiles[2]{ { mt * kt, memory::uninitialized }, { mt * kt, memory::uninitialized } };
+						memory::buffer<value_type> rhs_tiles[2]{ { kt * nt, memory::uninitialized }, { kt * nt, memory::uninitialized } };
+						memory::buffer<value_type> result_tile{ mt * nt, memory::uninitialized };
+
+						// tile q covers rows [i0, i0 + mb), columns [j0, j0 + nb) and depth [p0, p0 + kb); depth runs fastest
+						auto coordinates = [=](size_t q) {
+							auto i0{ (q / (ntiles * ktiles)) * mt };
+							auto j0{ ((q / ktiles) % ntiles) * nt };
+							auto p0{ (q % ktiles) * kt };
+							return std::make_tuple(i0, j0, p0, std::min(mt, m - i0), std::min(nt, n - j0), std::min(kt, k - p0));
+						};
+
+						auto stage = [&](size_t q) {
+							auto [i0, j0, p0, mb, nb, kb] { coordinates(q) };
+							const auto* a{ lhs_traits::pointer(lhs) };
+							const auto* b{ rhs_traits::pointer(rhs) };
+							auto rsa{ lhs_traits::row_stride(lhs) }, csa{ lhs_traits::column_stride(lhs) };
+							auto rsb{ rhs_traits::row_stride(rhs) }, csb{ rhs_traits::column_stride(rhs) };
+							auto* at{ lhs_tiles[q & 1u].data() };
+							auto* bt{ rhs_tiles[q & 1u].data() };
+							for (size_t i{ 0u }; i < mb; ++i)
+								for (size_t p{ 0u }; p < kb; ++p)
+									at[i * kb + p] = value_type(a[std::ptrdiff_t(i0 + i) * rsa + std::ptrdiff_t(p0 + p) * csa]);
+							for (size_t p{ 0u }; p < kb; ++p)
+								for (size_t j{ 0u }; j < nb; ++j)
+									bt[p * nb + j] = value_type(b[std::ptrdiff_t(p0 + p) * rsb + std::ptrdiff_t(j0 + j) * csb]);
+							// lhs rows are read by every tile of their row block, rhs rows by every row block
+							if (j0 + nb == n && p0 + kb == k)
+								advise(lhs, i0, i0 + mb, false);
+							if (i0 + mb == m && j0 + nb == n)
+								advise(rhs, p0, p0 + kb, false);
+						};
+
+						concurrency::thread_pool io{ 1u };
+						std::future<void> staged;
+						if (count > 0u)
+							staged = io.async([&stage] { stage(0u); });
+						for (size_t q{ 0u }; q < count; ++q) {
+							staged.get();
+							if (q + 1u < count)
+								staged = io.async([&stage, q] { stage(q + 1u); });
+							auto [i0, j0, p0, mb, nb, kb] { coordinates(q) };
+							kernel::gemm(mb, nb, kb, value_type(1), lhs_tiles[q & 1u].data(), std::ptrdiff_t(kb), std::ptrdiff_t(1),
+								rhs_tiles[q & 1u].data(), std::ptrdiff_t(nb), std::ptrdiff_t(1),
+								value_type(p0 == 0u ? 0 : 1), result_tile.data(), nb, threads);
+							if (p0 + kb == k) {
+								for (size_t i{ 0u }; i < mb; ++i)
+									std::copy_n(result_tile.data() + i * nb, nb, c + (i0 + i) * ldc + j0);
+								advise(retmat, i0, i0 + mb, false);
+							}
+						}
+						return retmat;
+					};
+
+					// out-of-core elementwise operation shared by addition and subtraction: row blocks within the
+					// budget are read ahead one block early, combined in parallel and evicted once written
+					auto elementwise = [](std::string_view path, const auto & lhs, const auto & rhs, auto op, const char* incompatible, const char* breached, const auto &... option) {
+						using lhs_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(lhs)> > >;
+						using rhs_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(rhs)> > >;
+						using value_type = typename lhs_traits::value_type;
+						if (!real::valued::matrix::integrity_check(lhs) || !real::valued::matrix::integrity_check(rhs))
+							throw std::runtime_error(breached);
+						if ((std::get<number_of_rows_>(lhs) != std::get<number_of_rows_>(rhs)) ||
+							(std::get<number_of_columns_>(lhs) != std::get<number_of_columns_>(rhs)))
+							throw std::runtime_error(incompatible);
+
+						auto nrows{ std::get<number_of_rows_>(lhs) };
+						auto ncols{ std::get<number_of_columns_>(lhs) };
+						auto threads{ concurrency::degree(option...) };
+						auto retmat{ create<value_type>(path, nrows, ncols, option...) };
+						auto ldc{ std::get<row_stride_>(retmat) };
+						auto* c{ std::get<data_>(retmat).data() };
+						const auto* a{ lhs_traits::pointer(lhs) };
+						const auto* b{ rhs_traits::pointer(rhs) };
+						auto rsa{ lhs_traits::row_stride(lhs) }, csa{ lhs_traits::column_stride(lhs) };
+						auto rsb{ rhs_traits::row_stride(rhs) }, csb{ rhs_traits::column_stride(rhs) };
+						auto row_bytes{ std::max<size_t>(ncols, 1u) * (sizeof(value_type) + sizeof(*a) + sizeof(*b)) };
+						auto block{ std::max<size_t>(working_set(option...) / (2u * row_bytes), 1u) };
+
+						if (nrows > 0u) {
+							advise(lhs, 0u, std::min(block, nrows), true);
+							advise(rhs, 0u, std::min(block, nrows), true);
+						}
+						for (size_t r0{ 0u }; r0 < nrows; r0 += block) {
+							auto r1{ std::min(r0 + block, nrows) };
+							advise(lhs, r1, std::min(r1 + block, nrows), true);
+							advise(rhs, r1, std::min(r1 + block, nrows), true);
+							kernel::zip(r1 - r0, ncols, threads, c + r0 * ldc, ldc,
+								a + std::ptrdiff_t(r0) * rsa, rsa, csa,
+								b + std::ptrdiff_t(r0) * rsb, rsb, csb,
+								[&op](const auto & x, const auto & y) { return value_type(op(x, y)); });
+							advise(lhs, r0, r1, false);
+							advise(rhs, r0, r1, false);
+							advise(retmat, r0, r1, false);
+						}
+						return retmat;
+					};
+
+					// out-of-core addition into a new matrix file at `path`
+					auto addition = [](std::string_view path, const auto & lhs, const auto & rhs, const auto &... option) {
+						return elementwise(path, lhs, rhs, std::plus<>{},
+							"Exception from real::valued:matrix::mapped::addition: matrices dimensions are not compatible with each other.",
+							"Exception from real::valued:matrix::mapped::addition: matrix integrity adjustment is breached.",
+							option...);
+					};
+
+					// out-of-core subtraction into a new matrix file at `path`
+					auto subtraction = [](std::string_view path, const auto & lhs, const auto & rhs, const auto &... option) {
+						return elementwise(path, lhs, rhs, std::minus<>{},
+							"Exception from real::valued:matrix::mapped::subtraction: matrices dimensions are not compatible with each other.",
+							"Exception from real::valued:matrix::mapped::subtraction: matrix integrity adjustment is breached.",
+							option...);
+					};
+				}
+
+				/***********************************************************************/
+				/* real-valued fixed-size matrix space                                 */
+				/***********************************************************************/
+				namespace fixed {
+
+					// real-valued fixed-size matrix: compile-time dimensions and in-place (stack) storage;
+					// std::get<number_of_rows_>/<number_of_columns_> yield integral constants convertible to size_t
+					template<typename T, size_t R, size_t C>
+					using _ = std::enable_if_t<std::is_arithmetic_v<T>,
+						std::tuple<std::integral_constant<size_t, R>, std::integral_constant<size_t, C>, std::array<T, R * C> > >;
+
+					// fixed-size matrix trait
+					template<typename X>
+					struct traits {
+						static constexpr bool is_fixed = false;
+					};
+
+					template<typename T, size_t R, size_t C, size_t N>
+					struct traits<std::tuple<std::integral_constant<size_t, R>, std::integral_constant<size_t, C>, std::array<T, N> > > {
+						static constexpr bool is_fixed = std::is_arithmetic_v<T> && R * C == N;
+						static constexpr size_t rows = R;
+						static constexpr size_t columns = C;
+						using value_type = T;
+					};
+
+					template<typename X>
+					using traits_t = traits<std::remove_cv_t<std::remove_reference_t<X> > >;
+
+					// calls fn(std::integral_constant<size_t, K>{}) for every K of the sequence, fully unrolled
+					template<typename Fn, size_t... K>
+					constexpr void unroll(Fn&& fn, std::index_sequence<K...>) {
+						(fn(std::integral_constant<size_t, K>{}), ...);
+					}
+
+					// fixed-size matrix constructor: fixed::constructor<R, C>(value or container)
+					template<size_t R, size_t C>
+					constexpr auto constructor = [](const auto & data) {
+						using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
+						if constexpr (std::is_arithmetic_v<data_type>) {
+							_<data_type, R, C> retmat{};
+							unroll([&](auto k) { std::get<data_>(retmat)[k] = data; }, std::make_index_sequence<R * C>{});
+							return retmat;
+						}
+						else {
+							using data_value_type = typename data_type::value_type;
+							_<data_value_type, R, C> retmat{};
+							auto it = std::begin(data);
+							for (size_t k{ 0u }; k < R * C && it != std::end(data); ++k, ++it)
+								std::get<data_>(retmat)[k] = *it;
+							return retmat;
+						}
+					};
+
+					// fixed-size identity matrix: fixed::identity<T, N>
+					template<typename T, size_t N>
+					constexpr auto identity = []() {
+						_<T, N, N> retmat{};
+						unroll([&](auto i) { std::get<data_>(retmat)[i * (N + 1u)] = T(1); }, std::make_index_sequence<N>{});
+						return retmat;
+					}();
+
+					// fixed-size matrix generator: fixed::generator<R, C>(fn, args...)
+					template<size_t R, size_t C>
+					constexpr auto generator = [](auto && fn, auto... args) {
+						using return_type = std::invoke_result_t<std::remove_reference_t<decltype(fn)>, decltype(args)...>;
+						_<return_type, R, C> retmat{};
+						for (auto& elem : std::get<data_>(retmat))
+							elem = fn(args...);
+						return retmat;
+					};
+
+					// fixed-size matrix apply function
+					constexpr auto apply = [](const auto & data, auto && fn) {
+						using data_traits = traits_t<decltype(data)>;
+						static_assert(data_traits::is_fixed, "fixed::apply expects a fixed-size matrix");
+						using value_type = typename data_traits::value_type;
+						_<value_type, data_traits::rows, data_traits::columns> retmat{};
+						unroll([&](auto k) { std::get<data_>(retmat)[k] = value_type(fn(std::get<data_>(data)[k])); },
+							std::make_index_sequence<data_traits::rows * data_traits::columns>{});
+						return retmat;
+					};
+
+					// fixed-size elementwise binary operation shared by addition and subtraction
+					constexpr auto elementwise = [](const auto & lhs, const auto & rhs, auto op) {
+						using lhs_traits = traits_t<decltype(lhs)>;
+						using rhs_traits = traits_t<decltype(rhs)>;
+						static_assert(lhs_traits::is_fixed && rhs_traits::is_fixed, "fixed-size matrices expected");
+						static_assert(lhs_traits::rows == rhs_traits::rows && lhs_traits::columns == rhs_traits::columns,
+							"matrices dimensions are not compatible with each other");
+						using value_type = typename lhs_traits::value_type;
+						_<value_type, lhs_traits::rows, lhs_traits::columns> retmat{};
+						unroll([&](auto k) { std::get<data_>(retmat)[k] = value_type(op(std::get<data_>(lhs)[k], std::get<data_>(rhs)[k])); },
+							std::make_index_sequence<lhs_traits::rows * lhs_traits::columns>{});
+						return retmat;
+					};
+
+					// fixed-size matrix addition function
+					constexpr auto addition = [](const auto & lhs, const auto & rhs) {
+						return elementwise(lhs, rhs, std::plus<>());
+					};
+
+					// fixed-size matrix subtraction function
+					constexpr auto subtraction = [](const auto & lhs, const auto & rhs) {
+						return elementwise(lhs, rhs, std::minus<>());
+					};
+
+					// fixed-size matrix multiplication function (every output element is an unrolled dot product)
+					constexpr auto multiplication = [](const auto & lhs, const auto & rhs) {
+						using lhs_traits = traits_t<decltype(lhs)>;
+						using rhs_traits = traits_t<decltype(rhs)>;
+						static_assert(lhs_traits::is_fixed && rhs_traits::is_fixed, "fixed-size matrices expected");
+						static_assert(lhs_traits::columns == rhs_traits::rows,
+							"matrices dimensions are not compatible for matrix multiplication");
+						constexpr size_t m{ lhs_traits::rows };
+						constexpr size_t k{ lhs_traits::columns };
+						constexpr size_t n{ rhs_traits::columns };
+						using value_type = std::common_type_t<typename lhs_traits::value_type, typename rhs_traits::value_type>;
+						_<value_type, m, n> retmat{};
+						unroll([&](auto ij) {
+							constexpr size_t i{ decltype(ij)::value / n };
+							constexpr size_t j{ decltype(ij)::value % n };
+							value_type acc{ 0 };
+							unroll([&](auto p) { acc += value_type(std::get<data_>(lhs)[i * k + p]) * value_type(std::get<data_>(rhs)[p * n + j]); },
+								std::make_index_sequence<k>{});
+							std::get<data_>(retmat)[ij] = acc;
+						}, std::make_index_sequence<m * n>{});
+						return retmat;
+					};
+
+					// conversion to a dynamic (valarray-backed) matrix
+					auto to_dynamic = [](const auto & data) {
+						using data_traits = traits_t<decltype(data)>;
+						using value_type = typename data_traits::value_type;
+						return std::make_tuple(data_traits::rows,
+							data_traits::columns,
+							std::valarray<value_type>(std::get<data_>(data).data(), data_traits::rows * data_traits::columns));
+					};
+
+					// conversion from a dynamic matrix (or any dense operand): fixed::from_dynamic<R, C>(mat)
+					template<size_t R, size_t C>
+					auto from_dynamic = [](const auto & mat) {
+						using mat_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(mat)> > >;
+						using value_type = typename mat_traits::value_type;
+						if (!real::valued::matrix::integrity_check(mat))
+							throw std::runtime_error("Exception from real::valued:matrix::fixed::from_dynamic: "
+								"matrix integrity adjustment is breached.");
+						if (std::get<number_of_rows_>(mat) != R || std::get<number_of_columns_>(mat) != C)
+							throw std::runtime_error("Exception from real::valued:matrix::fixed::from_dynamic: "
+								"matrix dimensions do not match the fixed-size dimensions.");
+						_<value_type, R, C> retmat{};
+						const auto* first{ mat_traits::pointer(mat) };
+						for (size_t i{ 0u }; i < R; ++i)
+							for (size_t j{ 0u }; j < C; ++j)
+								std::get<data_>(retmat)[i * C + j] = first[std::ptrdiff_t(i) * mat_traits::row_stride(mat) + std::ptrdiff_t(j) * mat_traits::column_stride(mat)];
+						return retmat;
+					};
+
+					// fixed-size matrix display
+					auto display = [](std::string_view title, const auto & data) {
+						real::valued::matrix::display(title, to_dynamic(data));
+					};
+				}
+
+				/***********************************************************************/
+				/* real-valued matrix batches space                                    */
+				/***********************************************************************/
+				namespace batched {
+
+					// batch of same-shaped row-major matrices stored one after another: (rows, columns, data, count)
+					template<typename T>
+					using _ = std::enable_if_t<std::is_arithmetic_v<T>, std::tuple<size_t, size_t, std::valarray<T>, size_t> >;
+
+					// non-owning strided batch: (rows, columns, first element, count, stride between entries);
+					// every entry is row-major and T is const-qualified for read-only batches
+					template<typename T>
+					using strided_t = std::tuple<size_t, size_t, T*, size_t, std::ptrdiff_t>;
+
+					// batch protocols (extend the generic matrix protocols)
+					constexpr size_t batch_size_ = 3u;
+					constexpr size_t batch_stride_ = 4u;
+
+					// batch traits: value type, first element, stride between entries and integrity
+					template<typename X>
+					struct traits {
+						static constexpr bool is_batch = false;
+					};
+
+					template<typename T>
+					struct traits<std::tuple<size_t, size_t, std::valarray<T>, size_t> > {
+						static constexpr bool is_batch = std::is_arithmetic_v<T>;
+						using value_type = T;
+						template<typename X> static auto pointer(X & x) { return kernel::pointer(std::get<data_>(x)); }
+						template<typename X> static std::ptrdiff_t stride(const X & x) {
+							return std::ptrdiff_t(std::get<number_of_rows_>(x) * std::get<number_of_columns_>(x));
+						}
+						template<typename X> static bool integrity(const X & x) {
+							return std::get<number_of_rows_>(x) * std::get<number_of_columns_>(x) * std::get<batch_size_>(x) == std::get<data_>(x).size();
+						}
+					};
+
+					template<typename T>
+					struct traits<std::tuple<size_t, size_t, T*, size_t, std::ptrdiff_t> > {
+						static constexpr bool is_batch = std::is_arithmetic_v<std::remove_const_t<T> >;
+						using value_type = std::remove_const_t<T>;
+						template<typename X> static T* pointer(X & x) { return std::get<data_>(x); }
+						template<typename X> static std::ptrdiff_t stride(const X & x) { return std::get<batch_stride_>(x); }
+						template<typename X> static bool integrity(const X &) { return true; }
+					};
+
+					template<typename X>
+					using traits_t = traits<std::remove_cv_t<std::remove_reference_t<X> > >;
+
+					// batch constructor: count matrices of rows x columns filled with a value, or with the elements of a
+					// container laid out entry after entry (missing elements are zero)
+					auto constructor = [](size_t count, size_t number_of_rows, size_t number_of_columns, const auto & data) {
+						auto stacked{ real::valued::matrix::constructor(count * number_of_rows, number_of_columns, data) };
+						return std::make_tuple(number_of_rows, number_of_columns, std::move(std::get<data_>(stacked)), count);
+					};
+
+					// strided batch over external storage: entries packed back to back unless a stride is given;
+					// a stride of 0 repeats one matrix across a read-only batch
+					auto strided = [](auto * first, size_t number_of_rows, size_t number_of_columns, size_t count, const auto &... stride) {
+						static_assert(sizeof...(stride) <= 1u, "a strided batch takes at most one stride");
+						auto retstride{ std::ptrdiff_t(number_of_rows * number_of_columns) };
+						((retstride = std::ptrdiff_t(stride)), ...);
+						return std::make_tuple(number_of_rows, number_of_columns, first, count, retstride);
+					};
+
+					// batch integrity check
+					auto integrity_check = [](const auto & data) {
+						if constexpr (traits_t<decltype(data)>::is_batch)
+							return traits_t<decltype(data)>::integrity(data);
+						else return false;
+					};
+
+					// entry l as a matrix view
+					auto entry = [](auto & data, size_t l) {
+						using data_traits = traits_t<decltype(data)>;
+						if (l >= std::get<batch_size_>(data))
+							throw std::runtime_error("Exception from real::valued:matrix::batched::entry: "
+								"entry index exceeds the batch size.");
+						return std::make_tuple(std::get<number_of_rows_>(data),
+							std::get<number_of_columns_>(data),
+							data_traits::pointer(data) + std::ptrdiff_t(l) * data_traits::stride(data),
+							std::ptrdiff_t(std::get<number_of_columns_>(data)),
+							std::ptrdiff_t(1));
+					};
+
+					// pairwise batch multiplication: entry l of the result is lhs_l * rhs_l; into(dst) writes into a
+					// batch (resized when valarray-backed) or a strided batch of the result shape
+					auto multiplication = [](const auto & lhs, const auto & rhs, const auto &... policy) {
+
+						using lhs_traits = traits_t<decltype(lhs)>;
+						using rhs_traits = traits_t<decltype(rhs)>;
+
+						if constexpr (lhs_traits::is_batch && rhs_traits::is_batch) {
+
+							using return_value_type = std::common_type_t<typename lhs_traits::value_type, typename rhs_traits::value_type>;
+
+							if (!integrity_check(lhs) || !integrity_check(rhs))
+								throw std::runtime_error("Exception from real::valued:matrix::batched::multiplication: "
+									"batch integrity adjustment is breached.");
+							if (std::get<batch_size_>(lhs) != std::get<batch_size_>(rhs) ||
+								std::get<number_of_columns_>(lhs) != std::get<number_of_rows_>(rhs))
+								throw std::runtime_error("Exception from real::valued:matrix::batched::multiplication: "
+									"batches are not compatible for pairwise matrix multiplication.");
+
+							auto count{ std::get<batch_size_>(lhs) };
+							auto nrows{ std::get<number_of_rows_>(lhs) };
+							auto ncols{ std::get<number_of_columns_>(rhs) };
+							auto depth{ std::get<number_of_columns_>(lhs) };
+
+							auto product = [&](auto & target) {
+								using target_traits = traits_t<decltype(target)>;
+								kernel::batched_gemm(count, nrows, ncols, depth,
+									lhs_traits::pointer(lhs), lhs_traits::stride(lhs),
+									rhs_traits::pointer(rhs), rhs_traits::stride(rhs),
+									target_traits::pointer(target), target_traits::stride(target),
+									concurrency::degree(policy...));
+							};
+
+							if constexpr (has_destination_v<decltype(policy)...>) {
+								auto& target{ destination_of(policy...) };
+								using target_type = std::remove_cv_t<std::remove_reference_t<decltype(target)> >;
+								using target_value_type = typename traits<target_type>::value_type;
+								if constexpr (std::is_same_v<target_type, _<target_value_type> >) {
+									if (std::get<data_>(target).size() != count * nrows * ncols)
+										std::get<data_>(target).resize(count * nrows * ncols);
+									std::get<number_of_rows_>(target) = nrows;
+									std::get<number_of_columns_>(target) = ncols;
+									std::get<batch_size_>(target) = count;
+								}
+								else if (std::get<number_of_rows_>(target) != nrows || std::get<number_of_columns_>(target) != ncols ||
+									std::get<batch_size_>(target) != count)
+									throw std::runtime_error("Exception from real::valued:matrix::batched::multiplication: "
+										"the destination dimensions are not compatible with the result.");
+								product(target);
+							}
+							else {
+								auto retbat{ std::make_tuple(nrows, ncols, std::valarray<return_value_type>(count * nrows * ncols), count) };
+								product(retbat);
+								return retbat;
+							}
+						}
+					};
+
+					// batch display (one matrix per entry)
+					auto display = [](std::string_view title, const auto & data) {
+						for (size_t l{ 0u }; l < std::get<batch_size_>(data); ++l)
+							real::valued::matrix::display(std::string(title) + "[" + std::to_string(l) + "]", view::copy(entry(data, l)));
+					};
+				}
+
+				/***********************************************************************/
+				/* real-valued matrix factorizations and linear solves                 */
+				/***********************************************************************/
+
+				// value type of factors and solutions: floating-point operands keep theirs, integral ones use double
+				template<typename T>
+				using factor_value_t = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+				// contiguous working copy of a dense operand converted to the type of `value`
+				auto convert = [](const auto & data, auto value, size_t threads) {
+					using value_type = decltype(value);
+					using traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >;
+					auto nrows{ std::get<number_of_rows_>(data) };
+					auto ncols{ std::get<number_of_columns_>(data) };
+					auto retmat{ std::make_tuple(nrows, ncols, std::valarray<value_type>(nrows * ncols)) };
+					kernel::map(nrows, ncols, threads, kernel::pointer(std::get<data_>(retmat)), ncols,
+						traits::pointer(data), traits::row_stride(data), traits::column_stride(data),
+						[](const typename traits::value_type& x) { return value_type(x); });
+					return retmat;
+				};
+
+				// triangle options of triangular_solve
+				struct lower_t {};
+				constexpr lower_t lower{};
+				struct upper_t {};
+				constexpr upper_t upper{};
+				struct unit_diagonal_t {};
+				constexpr unit_diagonal_t unit_diagonal{};
+
+				// triangular solve T X = B for a square lower (default) or upper triangular dense T and any dense B;
+				// options: lower, upper, unit_diagonal and an execution policy
+				auto triangular_solve = [](const auto & tri, const auto & rhs, const auto &... option) {
+					using tri_traits = dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(tri)> > >;
+					using rhs_value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(rhs)> > >::value_type;
+					using value_type = factor_value_t<std::common_type_t<typename tri_traits::value_type, rhs_value_type> >;
+					constexpr bool is_upper{ (std::is_same_v<std::remove_cv_t<std::remove_reference_t<decltype(option)> >, upper_t> || ...) };
+					constexpr bool is_unit{ (std::is_same_v<std::remove_cv_t<std::remove_reference_t<decltype(option)> >, unit_diagonal_t> || ...) };
+					if (!real::valued::matrix::integrity_check(tri) || !real::valued::matrix::integrity_check(rhs))
+						throw std::runtime_error("Exception from real::valued:matrix::triangular_solve: "
+							"matrix integrity adjustment is breached.");
+					auto n{ std::get<number_of_rows_>(tri) };
+					if (std::get<number_of_columns_>(tri) != n || std::get<number_of_rows_>(rhs) != n)
+						throw std::runtime_error("Exception from real::valued:matrix::triangular_solve: "
+							"matrices dimensions are not compatible for a triangular solve.");
+					auto threads{ concurrency::degree(option...) };
+					auto retmat{ convert(rhs, value_type(0), threads) };
+					kernel::trsm(is_upper, is_unit, n, std::get<number_of_columns_>(rhs),
+						tri_traits::pointer(tri), tri_traits::row_stride(tri), tri_traits::column_stride(tri),
+						kernel::pointer(std::get<data_>(retmat)), std::get<number_of_columns_>(rhs), threads);
+					return retmat;
+				};
+
+				/***********************************************************************/
+				/* real-valued matrix LU factorization space                           */
+				/***********************************************************************/
+				namespace lu {
+
+					// LU factorization P A = L U: (packed unit-lower L and upper U, row exchanged with row i at step i,
+					// whether a zero pivot was met); computed once and reused by every solve. The factors of a singular
+					// matrix are left incomplete: its determinant is 0 and it cannot be solved with
+					template<typename T>
+					using _ = std::tuple<real::valued::matrix::_<T>, std::vector<size_t>, bool>;
+
+					// LU factorization protocols
+					constexpr size_t factors_ = 0u;
+					constexpr size_t pivots_ = 1u;
+					constexpr size_t singular_ = 2u;
+
+					// blocked, parallel LU factorization with partial pivoting of a square dense operand
+					auto factorization = [](const auto & data, const auto &... policy) {
+						using data_value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+						using value_type = factor_value_t<data_value_type>;
+						if (!real::valued::matrix::integrity_check(data))
+							throw std::runtime_error("Exception from real::valued:matrix::lu::factorization: "
+								"matrix integrity adjustment is breached.");
+						auto n{ std::get<number_of_rows_>(data) };
+						if (std::get<number_of_columns_>(data) != n)
+							throw std::runtime_error("Exception from real::valued:matrix::lu::factorization: "
+								"only square matrices can be factored.");
+						auto threads{ concurrency::degree(policy...) };
+						_<value_type> retlu{ convert(data, value_type(0), threads), std::vector<size_t>(n), false };
+						std::get<singular_>(retlu) = !kernel::getrf(n, kernel::pointer(std::get<data_>(std::get<factors_>(retlu))), n,
+							std::get<pivots_>(retlu).data(), threads);
+						return retlu;
+					};
+
+					// solves A X = B for any dense B with a factorization of A
+					auto solve = [](const auto & factorization, const auto & rhs, const auto &... policy) {
+						const auto& factors{ std::get<factors_>(factorization) };
+						const auto& pivots{ std::get<pivots_>(factorization) };
+						using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(factors)> > >::value_type;
+						auto n{ std::get<number_of_rows_>(factors) };
+						if (std::get<singular_>(factorization))
+							throw std::runtime_error("Exception from real::valued:matrix::lu::solve: "
+								"the matrix is singular.");
+						if (!real::valued::matrix::integrity_check(rhs))
+							throw std::runtime_error("Exception from real::valued:matrix::lu::solve: "
+								"matrix integrity adjustment is breached.");
+						if (std::get<number_of_rows_>(rhs) != n)
+							throw std::runtime_error("Exception from real::valued:matrix::lu::solve: "
+								"the right-hand side does not match the factorization.");
+						auto threads{ concurrency::degree(policy...) };
+						auto retmat{ convert(rhs, value_type(0), threads) };
+						auto r{ std::get<number_of_columns_>(rhs) };
+						auto* x{ kernel::pointer(std::get<data_>(retmat)) };
+						for (size_t i{ 0u }; i < n; ++i)
+							if (pivots[i] != i)
+								std::swap_ranges(x + i * r, x + (i + 1u) * r, x + pivots[i] * r);
+						const auto* a{ kernel::pointer(std::get<data_>(factors)) };
+						kernel::trsm(false, true, n, r, a, std::ptrdiff_t(n), std::ptrdiff_t(1), x, r, threads);
+						kernel::trsm(true, false, n, r, a, std::ptrdiff_t(n), std::ptrdiff_t(1), x, r, threads);
+						return retmat;
+					};
+
+					// determinant of the factored matrix: the product of the diagonal of U, negated once per row exchange
+					// (0 for a singular matrix)
+					auto determinant = [](const auto & factorization) {
+						const auto& factors{ std::get<factors_>(factorization) };
+						const auto& pivots{ std::get<pivots_>(factorization) };
+						auto n{ std::get<number_of_rows_>(factors) };
+						auto retdet{ typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(factors)> > >::value_type(1) };
+						if (std::get<singular_>(factorization))
+							return decltype(retdet)(0);
+						for (size_t i{ 0u }; i < n; ++i)
+							retdet *= pivots[i] != i ? -std::get<data_>(factors)[i * (n + 1u)] : std::get<data_>(factors)[i * (n + 1u)];
+						return retdet;
+					};
+				}
+
+				/***********************************************************************/
+				/* real-valued matrix Cholesky factorization space                     */
+				/***********************************************************************/
+				namespace cholesky {
+
+					// Cholesky factorization A = L L^T: the lower triangular factor L (computed once, reused by every solve)
+					template<typename T>
+					using _ = real::valued::matrix::_<T>;
+
+					// blocked, parallel Cholesky factorization of a symmetric positive definite dense operand (only its
+					// lower triangle is read)
+					auto factorization = [](const auto & data, const auto &... policy) {
+						using data_value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(data)> > >::value_type;
+						using value_type = factor_value_t<data_value_type>;
+						if (!real::valued::matrix::integrity_check(data))
+							throw std::runtime_error("Exception from real::valued:matrix::cholesky::factorization: "
+								"matrix integrity adjustment is breached.");
+						auto n{ std::get<number_of_rows_>(data) };
+						if (std::get<number_of_columns_>(data) != n)
+							throw std::runtime_error("Exception from real::valued:matrix::cholesky::factorization: "
+								"only square matrices can be factored.");
+						auto threads{ concurrency::degree(policy...) };
+						auto retmat{ convert(data, value_type(0), threads) };
+						if (!kernel::potrf(n, kernel::pointer(std::get<data_>(retmat)), n, threads))
+							throw std::runtime_error("Exception from real::valued:matrix::cholesky::factorization: "
+								"the matrix is not positive definite.");
+						return retmat;
+					};
+
+					// solves A X = B for any dense B with the Cholesky factor of A (L Y = B, then L^T X = Y)
+					auto solve = [](const auto & factor, const auto & rhs, const auto &... policy) {
+						using value_type = typename dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(factor)> > >::value_type;
+						auto n{ std::get<number_of_rows_>(factor) };
+						if (!real::valued::matrix::integrity_check(factor) || !real::valued::matrix::integrity_check(rhs))
+							throw std::runtime_error("Exception from real::valued:matrix::cholesky::solve: "
+								"matrix integrity adjustment is breached.");
+						if (std::get<number_of_columns_>(factor) != n || std::get<number_of_rows_>(rhs) != n)
+							throw std::runtime_error("Exception from real::valued:matrix::cholesky::solve: "
+								"the right-hand side does not match the factorization.");
+						auto threads{ concurrency::degree(policy...) };
+						auto retmat{ convert(rhs, value_type(0), threads) };
+						auto r{ std::get<number_of_columns_>(rhs) };
+						auto* x{ kernel::pointer(std::get<data_>(retmat)) };
+						const auto* l{ kernel::pointer(std::get<data_>(factor)) };
+						kernel::trsm(false, false, n, r, l, std::ptrdiff_t(n), std::ptrdiff_t(1), x, r, threads);
+						kernel::trsm(true, false, n, r, l, std::ptrdiff_t(1), std::ptrdiff_t(n), x, r, threads);
+						return retmat;
+					};
+				}
+
+				// solves A X = B for a square dense A and any dense B through an LU factorization of A (factor once with
+				// lu::factorization and call lu::solve to reuse it across right-hand sides)
+				auto solve = [](const auto & lhs, const auto & rhs, const auto &... policy) {
+					return lu::solve(lu::factorization(lhs, policy...), rhs, policy...);
+				};
+
+				/***********************************************************************/
+				/* real-valued matrix asynchronous task graph space                    */
+				/***********************************************************************/
+				namespace async {
+
+					// shared state of a task graph node: its result or the exception that replaced it, and the
+					// continuations of the nodes depending on it
+					template<typename T>
+					class state {
+					public:
+						// runs fn once the node has completed (at once if it already has)
+						void then(std::function<void()> fn) {
+							{
+								std::lock_guard<std::mutex> lock{ mutex_ };
+								if (!ready_) {
+									continuations_.push_back(std::move(fn));
+									return;
+								}
+							}
+							fn();
+						}
+
+						// stores the result (before completion)
+						template<typename... A>
+						T& emplace(A&&... args) {
+							return value_.emplace(std::forward<A>(args)...);
+						}
+
+						// records an exception (before completion); get() rethrows it
+						void fail(std::exception_ptr error) {
+							error_ = std::move(error);
+						}
+
+						// marks the node completed and releases its dependents
+						void complete() {
+							std::vector<std::function<void()> > continuations;
+							{
+								std::lock_guard<std::mutex> lock{ mutex_ };
+								ready_ = true;
+								continuations.swap(continuations_);
+							}
+							completed_.notify_all();
+							for (auto& continuation : continuations)
+								continuation();
+						}
+
+						bool ready() const {
+							std::lock_guard<std::mutex> lock{ mutex_ };
+							return ready_;
+						}
+
+						void wait() const {
+							std::unique_lock<std::mutex> lock{ mutex_ };
+							completed_.wait(lock, [this] { return ready_; });
+						}
+
+						const T& get() const {
+							wait();
+							if (error_)
+								std::rethrow_exception(error_);
+							return *value_;
+						}
+
+					private:
+						mutable std::mutex mutex_;
+						mutable std::condition_variable completed_;
+						bool ready_{ false };
+						std::optional<T> value_;
+						std::exception_ptr error_;
+						std::vector<std::function<void()> > continuations_;
+					};
+
+					// handle to the future result of a task graph node; copies share the node
+					template<typename T>
+					class handle {
+					public:
+						using value_type = T;
+
+						explicit handle(std::shared_ptr<state<T> > node) : node_{ std::move(node) } {}
+
+						// whether the result (or its exception) is available
+						bool ready() const { return node_->ready(); }
+
+						// blocks until the node has completed
+						void wait() const { node_->wait(); }
+
+						// blocks until the node has completed and returns its result, or rethrows its exception
+						// (meant for callers outside the graph: a node waiting on another would hold a pool worker)
+						const T& get() const { return node_->get(); }
+
+						const std::shared_ptr<state<T> >& node() const { return node_; }
+
+					private:
+						std::shared_ptr<state<T> > node_;
+					};
+
+					// handle traits
+					template<typename X>
+					struct is_handle : std::false_type {};
+
+					template<typename T>
+					struct is_handle<handle<T> > : std::true_type {};
+
+					template<typename X>
+					constexpr bool is_handle_v = is_handle<std::remove_cv_t<std::remove_reference_t<X> > >::value;
+
+					// completed node holding a value
+					auto ready = [](auto && value) {
+						using value_type = std::remove_cv_t<std::remove_reference_t<decltype(value)> >;
+						auto node{ std::make_shared<state<value_type> >() };
+						node->emplace(std::forward<decltype(value)>(value));
+						node->complete();
+						return handle<value_type>{ node };
+					};
+
+					// graph operand: a handle is a dependency, a dense lvalue is viewed (it must outlive the nodes
+					// reading it) and any other value is moved (or copied) into a completed node
+					auto operand = [](auto && value) {
+						if constexpr (is_handle_v<decltype(value)>)
+							return value;
+						else if constexpr (std::is_lvalue_reference_v<decltype(value)> && is_dense_v<decltype(value)>)
+							return ready(view::of(value));
+						else
+							return ready(std::forward<decltype(value)>(value));
+					};
 
-						// row reference getter
-						auto ref = [](auto & data, size_t i) {
-							using data_type = std::remove_reference_t<decltype(data)>;
-							using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
-							if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >)
-								return std::get<data_>(data)[std::slice(i * std::get<number_of_columns_>(data),
-									std::get<number_of_columns_>(data),
-									1u)];
+					// runs task on the shared thread pool once every dependency has completed (one arrival per
+					// dependency plus one for the call itself, so the task cannot start before all are registered)
+					auto after = [](auto task, const auto &... dependency) {
+						auto run{ std::make_shared<decltype(task)>(std::move(task)) };
+						auto pending{ std::make_shared<std::atomic<size_t> >(sizeof...(dependency) + 1u) };
+						auto arrive = [pending, run]() {
+							if (pending->fetch_sub(1u) == 1u)
+								concurrency::default_pool().submit([run] { (*run)(); });
 						};
+						(dependency.node()->then(arrive), ...);
+						arrive();
+					};
 
-						// row copy getter
-						auto copy = [](const auto & data, size_t i) {
-							using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
-							using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
-							if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >)
-								return std::get<data_>(data)[std::slice(i * std::get<number_of_columns_>(data),
-									std::get<number_of_columns_>(data),
-									1u)];
-						};
-					}
+					// node computing fn(operand results...) on the shared thread pool once all its operands have
+					// completed; independent nodes run concurrently and an operand exception propagates downstream
+					auto launch = [](auto && fn, auto &&... operands) {
+						return [](auto fn, auto... dependency) {
+							using result_type = std::remove_cv_t<std::remove_reference_t<
+								std::invoke_result_t<decltype(fn)&, const typename decltype(dependency)::value_type &...> > >;
+							auto node{ std::make_shared<state<result_type> >() };
+							after([node, fn = std::move(fn), dependency...]() mutable {
+								try {
+									node->emplace(fn(dependency.get()...));
+								}
+								catch (...) {
+									node->fail(std::current_exception());
+								}
+								node->complete();
+							}, dependency...);
+							return handle<result_type>{ node };
+						}(std::forward<decltype(fn)>(fn), operand(std::forward<decltype(operands)>(operands))...);
+					};
 
-					/*******************************************************************/
-					/* column getters space                                            */
-					/*******************************************************************/
-					namespace column {
-						
-						// column reference getter
-						auto ref = [](auto & data, size_t j) {
-							using data_type = std::remove_reference_t<decltype(data)>;
-							using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
-							if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >)
-								return std::get<data_>(data)[std::slice(j, 
-									std::get<number_of_rows_>(data),
-									std::get<number_of_columns_>(data))];
-						};
+					// multiplication option splitting a dense product into row tiles computed as separate tasks
+					struct tiles {
+						size_t rows;
+					};
 
-						// column copy getter
-						auto copy = [](const auto & data, size_t j) {
-							using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
-							using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
-							if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >)
-								return std::get<data_>(data)[std::slice(j,
-									std::get<number_of_rows_>(data),
-									std::get<number_of_columns_>(data))];
-						};
-					}
+					// rows per tile requested by the options (0: one task)
+					auto tile_rows = [](const auto &... policy) -> size_t {
+						size_t rows{ 0u };
+						([&rows](const auto & p) {
+							if constexpr (std::is_same_v<std::remove_cv_t<std::remove_reference_t<decltype(p)> >, tiles>)
+								rows = p.rows;
+						}(policy), ...);
+						return rows;
+					};
 
-					// data[i][j] value getter
-					auto data = [](const auto & mat, size_t i, size_t j) {
-						using data_type = std::remove_cv_t<std::remove_reference_t<decltype(mat)> >;
-						using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
-						if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >)
-							return std::get<data_>(mat)[i * std::get<number_of_columns_>(mat) + j];
+					// asynchronous matrix multiplication; with tiles{ rows } the product of dense operands is computed
+					// by independent row-tile tasks writing into one result, the last of them completing the node
+					auto multiplication = [](auto && lhs, auto && rhs, const auto &... policy) {
+						auto a{ operand(std::forward<decltype(lhs)>(lhs)) };
+						auto b{ operand(std::forward<decltype(rhs)>(rhs)) };
+						using lhs_type = typename decltype(a)::value_type;
+						using rhs_type = typename decltype(b)::value_type;
+						auto whole = [policy...](const auto & x, const auto & y) { return real::valued::matrix::multiplication(x, y, policy...); };
+						if constexpr (dense_traits<lhs_type>::is_dense && dense_traits<rhs_type>::is_dense) {
+							using result_type = std::invoke_result_t<decltype(whole)&, const lhs_type&, const rhs_type&>;
+							using result_value_type = typename dense_traits<result_type>::value_type;
+							auto height{ tile_rows(policy...) };
+							if (height == 0u)
+								return launch(whole, a, b);
+							auto node{ std::make_shared<state<result_type> >() };
+							after([node, a, b, height, policy...]() {
+								try {
+									const auto& x{ a.get() };
+									const auto& y{ b.get() };
+									if (!real::valued::matrix::integrity_check(x) || !real::valued::matrix::integrity_check(y))
+										throw std::runtime_error("Exception from real::valued:matrix::async::multiplication: "
+											"matrix integrity adjustment is breached.");
+									if (std::get<number_of_columns_>(x) != std::get<number_of_rows_>(y))
+										throw std::runtime_error("Exception from real::valued:matrix::async::multiplication: "
+											"matrices dimensions are not compatible for matrix multiplication.");
+									auto nrows{ std::get<number_of_rows_>(x) };
+									auto ncols{ std::get<number_of_columns_>(y) };
+									auto depth{ std::get<number_of_columns_>(x) };
+									auto& c{ node->emplace(nrows, ncols, std::valarray<result_value_type>(nrows * ncols)) };
+									auto count{ (nrows + height - 1u) / height };
+									if (count == 0u) {
+										node->complete();
+										return;
+									}
+									struct progress {
+										std::atomic<size_t> remaining;
+										std::mutex mutex;
+										std::exception_ptr error;
+									};
+									auto shared{ std::make_shared<progress>() };
+									shared->remaining = count;
+									for (size_t t{ 0u }; t < count; ++t) {
+										auto first{ t * height };
+										auto rows{ std::min(height, nrows - first) };
+										concurrency::default_pool().submit([node, shared, a, b, &c, first, rows, ncols, depth, policy...]() {
+											try {
+												auto target{ view::block(c, first, 0u, rows, ncols) };
+												real::valued::matrix::multiplication(view::block(a.get(), first, 0u, rows, depth), b.get(),
+													into(target), policy...);
+											}
+											catch (...) {
+												std::lock_guard<std::mutex> lock{ shared->mutex };
+												if (!shared->error)
+													shared->error = std::current_exception();
+											}
+											if (shared->remaining.fetch_sub(1u) == 1u) {
+												if (shared->error)
+													node->fail(shared->error);
+												node->complete();
+											}
+										});
+									}
+								}
+								catch (...) {
+									node->fail(std::current_exception());
+									node->complete();
+								}
+							}, a, b);
+							return handle<result_type>{ node };
+						}
+						else
+							return launch(whole, a, b);
+					};
+
+					// asynchronous matrix addition
+					auto addition = [](auto && lhs, auto && rhs, const auto &... policy) {
+						return launch([policy...](const auto & x, const auto & y) { return real::valued::matrix::addition(x, y, policy...); },
+							std::forward<decltype(lhs)>(lhs), std::forward<decltype(rhs)>(rhs));
+					};
+
+					// asynchronous matrix subtraction
+					auto subtraction = [](auto && lhs, auto && rhs, const auto &... policy) {
+						return launch([policy...](const auto & x, const auto & y) { return real::valued::matrix::subtraction(x, y, policy...); },
+							std::forward<decltype(lhs)>(lhs), std::forward<decltype(rhs)>(rhs));
+					};
+
+					// asynchronous apply
+					auto apply = [](auto && data, auto fn, const auto &... policy) {
+						return launch([fn, policy...](const auto & x) { return real::valued::matrix::apply(x, fn, policy...); },
+							std::forward<decltype(data)>(data));
 					};
 				}
 
 				/***********************************************************************/
-				/* real-valued matrix space real-valued matrix setters space           */
+				/* real-valued matrix kernel tuning space                              */
 				/***********************************************************************/
-				namespace set {
+				namespace tuning {
 
-					/*******************************************************************/
-					/* row setters space                                               */
-					/*******************************************************************/
-					auto row = [](auto & data, size_t i, auto&& value, auto... args) {
-						using data_type = std::remove_reference_t<decltype(data)>;
-						using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
-						if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
-							using value_type = std::remove_reference_t<decltype(value)>;
-							if constexpr (std::is_arithmetic_v<value_type>)
-								std::get<data_>(data)[std::slice(i * std::get<number_of_columns_>(data),
-									std::get<number_of_columns_>(data),
-									1u)] = value;
-							else if constexpr (std::is_invocable_v<value_type, decltype(args)...> &&
-								std::is_arithmetic_v<std::invoke_result_t<value_type, decltype(args)...> >) {
-								std::get<data_>(data)[std::slice(i * std::get<number_of_columns_>(data),
-									std::get<number_of_columns_>(data),
-									1u)] = value(args...);
-							}
+					// host-specific kernel parameters: the gemm cache blocking of the floating types (16-bit floats
+					// multiply through binary32) and the parallel threshold
+					struct profile {
+						size_t simd_width;				// instruction set the parameters were measured with
+						size_t hardware_threads;		// threads of the host
+						size_t threads;					// threads the products were tuned for
+						kernel::blocking single;		// float products
+						kernel::blocking double_;		// double products
+						size_t parallel_grain;			// elements below which an operation stays on the caller
+					};
+
+					// cache file format version
+					constexpr size_t version_ = 2u;
+
+					// parameters in effect (for products run with the default degree of parallelism)
+					auto current = []() {
+						return profile{ kernel::host_simd_width(), std::thread::hardware_concurrency(), concurrency::degree(),
+							kernel::gemm_blocking<float>, kernel::gemm_blocking<double>, concurrency::parallel_grain };
+					};
+
+					// installs a profile (before operations are started: the parameters are plain globals)
+					auto apply = [](const profile & p) {
+						kernel::gemm_blocking<float> = p.single;
+						kernel::gemm_blocking<double> = p.double_;
+						concurrency::parallel_grain = p.parallel_grain;
+					};
+
+					// best wall time of fn() over `repetitions` runs, in seconds
+					auto seconds = [](auto && fn, size_t repetitions) {
+						auto best{ std::numeric_limits<double>::infinity() };
+						for (size_t r{ 0u }; r < repetitions; ++r) {
+							auto start{ std::chrono::steady_clock::now() };
+							fn();
+							best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
 						}
+						return best;
 					};
 
-					/*******************************************************************/
-					/* column setters space                                            */
-					/*******************************************************************/
-					auto column = [](auto & data, size_t j, auto && value, auto... args) {
-						using data_type = std::remove_reference_t<decltype(data)>;
-						using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
-						if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
-							using value_type = std::remove_reference_t<decltype(value)>;
-							if constexpr (std::is_arithmetic_v<value_type>)
-								std::get<data_>(data)[std::slice(j,
-									std::get<number_of_rows_>(data),
-									std::get<number_of_columns_>(data))] = value;
-							else if constexpr (std::is_invocable_v<value_type, decltype(args)...> &&
-								std::is_arithmetic_v<std::invoke_result_t<value_type, decltype(args)...> >) {
-								std::get<data_>(data)[std::slice(j,
-									std::get<number_of_rows_>(data),
-									std::get<number_of_columns_>(data))] = value(args...);
+					// coordinate search of the gemm blocking of T (depth, then lhs block rows, then rhs block columns)
+					// on a product large enough to exercise every cache level
+					auto blocking_of = [](auto zero, size_t threads) {
+						using value_type = decltype(zero);
+						constexpr size_t m{ 384u }, n{ 2048u }, k{ 512u };
+						std::valarray<value_type> a(value_type(0.5), m * k), b(value_type(0.25), k * n), c(m * n);
+						auto saved{ kernel::gemm_blocking<value_type> };
+						auto time = [&](const kernel::blocking & candidate) {
+							kernel::gemm_blocking<value_type> = candidate;
+							return seconds([&]() {
+								kernel::blocked_gemm(m, n, k, value_type(1), &a[0], std::ptrdiff_t(k), std::ptrdiff_t(1),
+									&b[0], std::ptrdiff_t(n), std::ptrdiff_t(1), value_type(0), &c[0], n, threads);
+							}, 3u);
+						};
+						auto best{ saved };
+						time(best);
+						auto best_time{ time(best) };
+						// a candidate must win by 3% to replace the incumbent (timing noise)
+						auto consider = [&](const kernel::blocking & candidate) {
+							auto t{ time(candidate) };
+							if (t < 0.97 * best_time) {
+								best = candidate;
+								best_time = t;
 							}
-						}
+						};
+						for (size_t kc : { 128u, 192u, 256u, 384u, 512u })
+							consider({ best.mc, kc, best.nc });
+						for (size_t bytes : { 64u << 10u, 128u << 10u, 256u << 10u, 512u << 10u, 1u << 20u })
+							consider({ std::max<size_t>(bytes / (best.kc * sizeof(value_type)), 8u), best.kc, best.nc });
+						for (size_t bytes : { 1u << 20u, 2u << 20u, 4u << 20u })
+							consider({ best.mc, best.kc, std::max<size_t>(bytes / (best.kc * sizeof(value_type)), 64u) });
+						kernel::gemm_blocking<value_type> = saved;
+						return best;
 					};
 
-					// data[i][j] value setter
-					auto data = [](auto & mat, size_t i, size_t j, auto&& value, auto... args) {
-						using data_type = std::remove_reference_t<decltype(mat)>;
-						using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
-						if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
-							using value_type = std::remove_reference_t<decltype(value)>;
-							if constexpr (std::is_arithmetic_v<value_type>)
-								std::get<data_>(mat)[i * std::get<number_of_columns_>(mat) + j] = value;
-							else if constexpr (std::is_invocable_v<value_type, decltype(args)...> &&
-								std::is_arithmetic_v<std::invoke_result_t<value_type, decltype(args)...> >) {
-								std::get<data_>(mat)[i * std::get<number_of_columns_>(mat) + j] = value(args...);
+					// smallest grain from which the two-chunk parallel addition beats the sequential one at every larger
+					// candidate too (median of five rounds each); the largest candidate when none does or the host has a
+					// single core, where any parallel win is timing noise
+					auto grain_of = [](size_t threads) {
+						constexpr size_t candidates[]{ 4096u, 8192u, 16384u, 32768u, 65536u, 131072u, 262144u };
+						constexpr size_t count{ std::size(candidates) };
+						auto saved{ concurrency::parallel_grain };
+						std::valarray<float> a(1.0f, 2u * candidates[count - 1u]), c(a.size());
+						// median over rounds of the parallel to sequential time ratio at grain g
+						auto ratio = [&](size_t g) {
+							concurrency::parallel_grain = g;
+							auto add = [&](size_t t) {
+								return seconds([&]() {
+									kernel::zip(1u, 2u * g, t, &c[0], 2u * g, &a[0], std::ptrdiff_t(2u * g), std::ptrdiff_t(1),
+										&a[0], std::ptrdiff_t(2u * g), std::ptrdiff_t(1), std::plus<>{});
+								}, 8u);
+							};
+							add(2u);
+							std::array<double, 5u> ratios{};
+							for (auto& r : ratios)
+								r = add(2u) / add(1u);
+							std::nth_element(ratios.begin(), ratios.begin() + ratios.size() / 2u, ratios.end());
+							return ratios[ratios.size() / 2u];
+						};
+						auto grain{ candidates[count - 1u] };
+						if (threads > 1u && std::thread::hardware_concurrency() > 1u) {
+							std::array<bool, count> wins{};
+							for (size_t i{ count }; i-- > 0u;) {
+								wins[i] = ratio(candidates[i]) < 0.9;
+								if (!wins[i])
+									break;
+								if (i + 1u == count || wins[i + 1u])
+									grain = candidates[i];
 							}
 						}
+						concurrency::parallel_grain = saved;
+						return grain;
 					};
-				}
 
-				// real-valued matrix generator
-				auto generator = [](size_t number_of_rows, size_t number_of_columns, auto && fn, auto... args) {
-					using data_type = std::remove_reference_t<decltype(fn)>;
-					if constexpr (std::is_invocable_v<data_type, decltype(args)...>) {
-						using return_type = std::invoke_result_t<data_type, decltype(args)...>;
-						auto retmat{ std::make_tuple(number_of_rows,
-							number_of_columns,
-							std::valarray<return_type>(return_type(0), number_of_rows * number_of_columns)) };
-						for (auto& elem : std::get<data_>(retmat))
-							elem = fn(args...);
-						return retmat;
-					}
-				};
+					// measures the parameters of the host (about a second); the execution policy sets the threads the
+					// products are tuned for
+					auto autotune = [](const auto &... policy) {
+						auto threads{ concurrency::degree(policy...) };
+						auto p{ current() };
+						p.threads = threads;
+						p.single = blocking_of(0.0f, threads);
+						p.double_ = blocking_of(0.0, threads);
+						p.parallel_grain = grain_of(concurrency::default_pool().size() + 1u);
+						return p;
+					};
 
-				// real-valued matrix integrity check
-				auto integrity_check = [](const auto& data) {
-					using data_type = std::remove_cv_t<std::remove_reference_t<decltype(data)> >;
-					using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
-					if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >)
-						if ((std::get<number_of_rows_>(data) * std::get<number_of_columns_>(data)) == std::get<data_>(data).size())
-							return true;
-						else return false;
-					else return false;
-				};
+					// writes a profile as text
+					auto save = [](std::string_view path, const profile & p) {
+						std::ofstream os{ std::string(path) };
+						os << "hpmx-tuning " << version_ << '\n'
+							<< "simd_width " << p.simd_width << '\n'
+							<< "hardware_threads " << p.hardware_threads << '\n'
+							<< "threads " << p.threads << '\n'
+							<< "float " << p.single.mc << ' ' << p.single.kc << ' ' << p.single.nc << '\n'
+							<< "double " << p.double_.mc << ' ' << p.double_.kc << ' ' << p.double_.nc << '\n'
+							<< "parallel_grain " << p.parallel_grain << '\n';
+						if (!os)
+							throw std::runtime_error("Exception from real::valued:matrix::tuning::save: cannot write the file.");
+					};
 
-				// real-valued matrix apply function
-				auto apply = [](auto & data, auto&& fn) {
-					using data_type = std::remove_reference_t<decltype(data)>;
-					using data_value_type = typename std::tuple_element_t<data_, data_type>::value_type;
-					if constexpr (std::is_same_v<data_type, real::valued::matrix::_<data_value_type> >) {
-						using fn_type = std::remove_reference_t<decltype(fn)>;
-						if constexpr (std::is_invocable_r_v<data_value_type, fn_type, const data_value_type&>) {
-							return std::make_tuple(std::get<number_of_rows_>(data),
-								std::get<number_of_columns_>(data),
-								std::get<data_>(data).apply(std::forward<fn_type>(fn)));
+					// reads a profile written by save
+					auto load = [](std::string_view path) {
+						std::ifstream is{ std::string(path) };
+						std::string magic, key;
+						size_t format{ 0u };
+						profile p{};
+						is >> magic >> format;
+						if (!is || magic != "hpmx-tuning" || format != version_)
+							throw std::runtime_error("Exception from real::valued:matrix::tuning::load: not a tuning file of this version.");
+						while (is >> key) {
+							if (key == "simd_width")
+								is >> p.simd_width;
+							else if (key == "hardware_threads")
+								is >> p.hardware_threads;
+							else if (key == "threads")
+								is >> p.threads;
+							else if (key == "float")
+								is >> p.single.mc >> p.single.kc >> p.single.nc;
+							else if (key == "double")
+								is >> p.double_.mc >> p.double_.kc >> p.double_.nc;
+							else if (key == "parallel_grain")
+								is >> p.parallel_grain;
+							else
+								throw std::runtime_error("Exception from real::valued:matrix::tuning::load: unknown entry " + key + ".");
 						}
-					}
-				};
+						if (!is.eof() || p.threads == 0u || p.single.kc == 0u || p.double_.kc == 0u || p.parallel_grain == 0u)
+							throw std::runtime_error("Exception from real::valued:matrix::tuning::load: malformed tuning file.");
+						return p;
+					};
 
-				// real-valued matrix addition function
-				auto addition = [](const auto & lhs, const auto & rhs) {
+					// one-time tuning cached at `path`: a profile measured on the same instruction set and host thread
+					// count for the threads of the execution policy is reused, anything else is re-measured and
+					// rewritten; the profile is installed and returned
+					auto tune = [](std::string_view path, const auto &... policy) {
+						auto p{ [&]() {
+							try {
+								auto cached{ load(path) };
+								if (cached.simd_width == kernel::host_simd_width() && cached.hardware_threads == std::thread::hardware_concurrency() &&
+									cached.threads == concurrency::degree(policy...))
+									return cached;
+							}
+							catch (const std::runtime_error&) {
+								// missing or malformed cache: measure again
+							}
+							auto measured{ autotune(policy...) };
+							save(path, measured);
+							return measured;
+						}() };
+						apply(p);
+						return p;
+					};
+				}
+			}
 
-					using lhs_type = std::remove_cv_t<std::remove_reference_t<decltype(lhs)> >;
-					using lhs_value_type = typename std::tuple_element_t<data_, lhs_type>::value_type;
+			/***************************************************************************/
+			/* real-valued sparse matrix space                                         */
+			/***************************************************************************/
+			namespace sparse {
 
-					using rhs_type = std::remove_cv_t<std::remove_reference_t<decltype(rhs)> >;
-					using rhs_value_type = typename std::tuple_element_t<data_, rhs_type>::value_type;
+				// generic matrix protocols (data_ holds the nonzero values)
+				using matrix::number_of_rows_;
+				using matrix::number_of_columns_;
+				using matrix::data_;
 
-					if constexpr (std::is_same_v<lhs_type, real::valued::matrix::_<lhs_value_type> > &&
-						std::is_same_v<rhs_type, real::valued::matrix::_<rhs_value_type> >) {
+				// sparse matrix protocols
+				constexpr size_t indices_ = 3u;		// minor-axis index of every nonzero
+				constexpr size_t pointers_ = 4u;	// major-axis offsets into data_/indices_ (major extent + 1 entries)
+				constexpr size_t format_ = 5u;		// storage format tag
 
-						if (real::valued::matrix::integrity_check(lhs) && real::valued::matrix::integrity_check(rhs)) {
-							if ((std::get<number_of_rows_>(lhs) == std::get<number_of_rows_>(rhs)) &&
-								(std::get<number_of_columns_>(lhs) == std::get<number_of_columns_>(rhs))) {
+				// storage format tags
+				struct compressed_rows {};
+				struct compressed_columns {};
 
-								return std::make_tuple(std::get<number_of_rows_>(lhs),
-									std::get<number_of_columns_>(lhs),
-									std::get<data_>(lhs) + std::get<data_>(rhs));
-							}
-							else
-								throw std::exception("Exception from real::valued:matrix::addition: "
-									"matrices dimensions are not compatible with each other.");
-						}
-						else
-							throw std::exception("Exception from real::valued:matrix::addition: "
-								"matrix integrity adjustment is breached.");
-					}
+				/***********************************************************************/
+				/* compressed sparse row space                                         */
+				/***********************************************************************/
+				namespace csr {
+
+					// real-valued CSR matrix: (rows, columns, values, column indices, row pointers, format)
+					template<typename T, typename I = std::uint32_t>
+					using _ = std::enable_if_t<std::is_arithmetic_v<T> && std::is_unsigned_v<I>,
+						std::tuple<size_t, size_t, std::vector<T>, std::vector<I>, std::vector<size_t>, compressed_rows> >;
+				}
+
+				/***********************************************************************/
+				/* compressed sparse column space                                      */
+				/***********************************************************************/
+				namespace csc {
+
+					// real-valued CSC matrix: (rows, columns, values, row indices, column pointers, format)
+					template<typename T, typename I = std::uint32_t>
+					using _ = std::enable_if_t<std::is_arithmetic_v<T> && std::is_unsigned_v<I>,
+						std::tuple<size_t, size_t, std::vector<T>, std::vector<I>, std::vector<size_t>, compressed_columns> >;
+				}
+
+				// sparse matrix traits
+				template<typename X>
+				struct traits {
+					static constexpr bool is_sparse = false;
 				};
 
-				// real-valued matrix subtraction function
-				auto subtraction = [](const auto & lhs, const auto & rhs) {
+				template<typename T, typename I, typename F>
+				struct traits<std::tuple<size_t, size_t, std::vector<T>, std::vector<I>, std::vector<size_t>, F> > {
+					static constexpr bool is_sparse = std::is_arithmetic_v<T> && std::is_unsigned_v<I> &&
+						(std::is_same_v<F, compressed_rows> || std::is_same_v<F, compressed_columns>);
+					static constexpr bool is_csr = std::is_same_v<F, compressed_rows>;
+					using value_type = T;
+					using index_type = I;
+					using format_type = F;
+					template<typename X> static size_t major(const X & x) { return is_csr ? std::get<number_of_rows_>(x) : std::get<number_of_columns_>(x); }
+					template<typename X> static size_t minor(const X & x) { return is_csr ? std::get<number_of_columns_>(x) : std::get<number_of_rows_>(x); }
+				};
 
-					using lhs_type = std::remove_cv_t<std::remove_reference_t<decltype(lhs)> >;
-					using lhs_value_type = typename std::tuple_element_t<data_, lhs_type>::value_type;
+				template<typename X>
+				using traits_t = traits<std::remove_cv_t<std::remove_reference_t<X> > >;
 
-					using rhs_type = std::remove_cv_t<std::remove_reference_t<decltype(rhs)> >;
-					using rhs_value_type = typename std::tuple_element_t<data_, rhs_type>::value_type;
+				// number of stored nonzeros
+				auto number_of_nonzeros = [](const auto & data) {
+					return std::get<data_>(data).size();
+				};
 
-					if constexpr (std::is_same_v<lhs_type, real::valued::matrix::_<lhs_value_type> > &&
-						std::is_same_v<rhs_type, real::valued::matrix::_<rhs_value_type> >) {
+				// sparse matrix integrity check
+				auto integrity_check = [](const auto & data) {
+					using data_traits = traits_t<decltype(data)>;
+					if constexpr (data_traits::is_sparse) {
+						const auto& pointers{ std::get<pointers_>(data) };
+						const auto& indices{ std::get<indices_>(data) };
+						if (pointers.size() != data_traits::major(data) + 1u || pointers.front() != 0u ||
+							pointers.back() != std::get<data_>(data).size() || indices.size() != std::get<data_>(data).size())
+							return false;
+						for (size_t k{ 1u }; k < pointers.size(); ++k)
+							if (pointers[k] < pointers[k - 1u])
+								return false;
+						return std::all_of(indices.begin(), indices.end(), [&](auto index) { return size_t(index) < data_traits::minor(data); });
+					}
+					else return false;
+				};
 
-						if (real::valued::matrix::integrity_check(lhs) && real::valued::matrix::integrity_check(rhs)) {
-							if ((std::get<number_of_rows_>(lhs) == std::get<number_of_rows_>(rhs)) &&
-								(std::get<number_of_columns_>(lhs) == std::get<number_of_columns_>(rhs))) {
+				// builds a compressed matrix from (major, minor, value) entries: entries are bucketed along the
+				// major axis, sorted along the minor axis, duplicates summed and explicit zeros kept
+				auto compress = [](size_t number_of_rows, size_t number_of_columns, auto format, auto index, auto value, auto && entries) {
+					using format_type = decltype(format);
+					using index_type = decltype(index);
+					using value_type = decltype(value);
+					constexpr bool is_csr{ std::is_same_v<format_type, compressed_rows> };
+					auto major_count{ is_csr ? number_of_rows : number_of_columns };
+					auto minor_count{ is_csr ? number_of_columns : number_of_rows };
+					if (minor_count > size_t(std::numeric_limits<index_type>::max()) + 1u)
+						throw std::runtime_error("Exception from real::valued:sparse::compress: "
+							"matrix dimensions exceed the range of the index type.");
+
+					std::vector<size_t> pointers(major_count + 1u, 0u);
+					for (const auto& entry : entries) {
+						auto major{ is_csr ? size_t(std::get<0>(entry)) : size_t(std::get<1>(entry)) };
+						if (size_t(std::get<0>(entry)) >= number_of_rows || size_t(std::get<1>(entry)) >= number_of_columns)
+							throw std::runtime_error("Exception from real::valued:sparse::compress: "
+								"entry index exceeds the matrix dimensions.");
+						++pointers[major + 1u];
+					}
+					std::partial_sum(pointers.begin(), pointers.end(), pointers.begin());
 
-								return std::make_tuple(std::get<number_of_rows_>(lhs),
-									std::get<number_of_columns_>(lhs),
-									std::get<data_>(lhs) - std::get<data_>(rhs));
+					std::vector<index_type> indices(pointers.back());
+					std::vector<value_type> values(pointers.back());
+					std::vector<size_t> cursor(pointers.begin(), pointers.end() - 1);
+					for (const auto& entry : entries) {
+						auto major{ is_csr ? size_t(std::get<0>(entry)) : size_t(std::get<1>(entry)) };
+						auto minor{ is_csr ? size_t(std::get<1>(entry)) : size_t(std::get<0>(entry)) };
+						indices[cursor[major]] = index_type(minor);
+						values[cursor[major]++] = value_type(std::get<2>(entry));
+					}
+
+					std::vector<std::pair<index_type, value_type> > segment;
+					size_t write{ 0u };
+					for (size_t major{ 0u }; major < major_count; ++major) {
+						segment.clear();
+						for (auto k{ pointers[major] }; k < pointers[major + 1u]; ++k)
+							segment.emplace_back(indices[k], values[k]);
+						std::sort(segment.begin(), segment.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+						pointers[major] = write;
+						for (size_t k{ 0u }; k < segment.size(); ++k) {
+							if (k > 0u && segment[k].first == segment[k - 1u].first)
+								values[write - 1u] += segment[k].second;
+							else {
+								indices[write] = segment[k].first;
+								values[write++] = segment[k].second;
 							}
+						}
+					}
+					pointers[major_count] = write;
+					indices.resize(write);
+					values.resize(write);
+					return std::make_tuple(number_of_rows, number_of_columns, std::move(values), std::move(indices), std::move(pointers), format_type{});
+				};
+
+				// compressed matrix from a dense operand (matrix, aligned matrix or view); |x| <= tolerance is dropped
+				auto from_dense = [](const auto & mat, auto format, auto index, auto tolerance) {
+					using mat_traits = matrix::dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(mat)> > >;
+					using value_type = typename mat_traits::value_type;
+					using index_type = decltype(index);
+					constexpr bool is_csr{ std::is_same_v<decltype(format), compressed_rows> };
+					if (!matrix::integrity_check(mat))
+						throw std::runtime_error("Exception from real::valued:sparse::from_dense: "
+							"matrix integrity adjustment is breached.");
+					auto nrows{ std::get<number_of_rows_>(mat) };
+					auto ncols{ std::get<number_of_columns_>(mat) };
+					auto major_count{ is_csr ? nrows : ncols };
+					auto minor_count{ is_csr ? ncols : nrows };
+					if (minor_count > size_t(std::numeric_limits<index_type>::max()) + 1u)
+						throw std::runtime_error("Exception from real::valued:sparse::from_dense: "
+							"matrix dimensions exceed the range of the index type.");
+					const auto* first{ mat_traits::pointer(mat) };
+					auto rs{ mat_traits::row_stride(mat) };
+					auto cs{ mat_traits::column_stride(mat) };
+					auto at = [&](size_t major, size_t minor) {
+						return is_csr ? first[std::ptrdiff_t(major) * rs + std::ptrdiff_t(minor) * cs] : first[std::ptrdiff_t(minor) * rs + std::ptrdiff_t(major) * cs];
+					};
+					std::vector<size_t> pointers(major_count + 1u, 0u);
+					std::vector<index_type> indices;
+					std::vector<value_type> values;
+					for (size_t major{ 0u }; major < major_count; ++major) {
+						for (size_t minor{ 0u }; minor < minor_count; ++minor) {
+							auto x{ at(major, minor) };
+							// -tolerance would wrap for unsigned types and overflow for the most negative signed value
+							bool is_kept{ false };
+							if constexpr (std::is_unsigned_v<value_type>)
+								is_kept = x > tolerance;
+							else if constexpr (std::is_integral_v<value_type>)
+								is_kept = x > tolerance || x + tolerance < value_type(0);
 							else
-								throw std::exception("Exception from real::valued:matrix::subtraction: "
-									"matrices dimensions are not compatible with each other.");
+								is_kept = std::abs(x) > tolerance;
+							if (is_kept) {
+								indices.push_back(index_type(minor));
+								values.push_back(x);
+							}
 						}
-						else
-							throw std::exception("Exception from real::valued:matrix::subtraction: "
-								"matrix integrity adjustment is breached.");
+						pointers[major + 1u] = values.size();
 					}
+					return std::make_tuple(nrows, ncols, std::move(values), std::move(indices), std::move(pointers), decltype(format){});
+				};
+
+				// dense (valarray-backed) copy of a compressed matrix
+				auto to_dense = [](const auto & data) {
+					using data_traits = traits_t<decltype(data)>;
+					using value_type = typename data_traits::value_type;
+					auto nrows{ std::get<number_of_rows_>(data) };
+					auto ncols{ std::get<number_of_columns_>(data) };
+					auto retmat{ std::make_tuple(nrows, ncols, std::valarray<value_type>(value_type(0), nrows * ncols)) };
+					const auto& pointers{ std::get<pointers_>(data) };
+					for (size_t major{ 0u }; major + 1u < pointers.size(); ++major)
+						for (auto k{ pointers[major] }; k < pointers[major + 1u]; ++k) {
+							auto minor{ size_t(std::get<indices_>(data)[k]) };
+							std::get<data_>(retmat)[data_traits::is_csr ? major * ncols + minor : minor * ncols + major] = std::get<data_>(data)[k];
+						}
+					return retmat;
 				};
 
-				// real-valued matrix multiplication function
-				auto multiplication = [](auto & lhs, auto & rhs) {
+				// the same matrix in the other compressed format (CSR <-> CSC), by a counting sort on the minor indices
+				auto transpose_format = [](const auto & data) {
+					using data_traits = traits_t<decltype(data)>;
+					using value_type = typename data_traits::value_type;
+					using index_type = typename data_traits::index_type;
+					using format_type = std::conditional_t<data_traits::is_csr, compressed_columns, compressed_rows>;
+					auto major_count{ data_traits::major(data) };
+					auto minor_count{ data_traits::minor(data) };
+					if (major_count > size_t(std::numeric_limits<index_type>::max()) + 1u)
+						throw std::runtime_error("Exception from real::valued:sparse::transpose_format: "
+							"matrix dimensions exceed the range of the index type.");
+					const auto& pointers{ std::get<pointers_>(data) };
+					const auto& indices{ std::get<indices_>(data) };
+					std::vector<size_t> retpointers(minor_count + 1u, 0u);
+					for (auto index : indices)
+						++retpointers[size_t(index) + 1u];
+					std::partial_sum(retpointers.begin(), retpointers.end(), retpointers.begin());
+					std::vector<index_type> retindices(indices.size());
+					std::vector<value_type> retvalues(indices.size());
+					std::vector<size_t> cursor(retpointers.begin(), retpointers.end() - 1);
+					for (size_t major{ 0u }; major < major_count; ++major)
+						for (auto k{ pointers[major] }; k < pointers[major + 1u]; ++k) {
+							auto slot{ cursor[size_t(indices[k])]++ };
+							retindices[slot] = index_type(major);
+							retvalues[slot] = std::get<data_>(data)[k];
+						}
+					return std::make_tuple(std::get<number_of_rows_>(data), std::get<number_of_columns_>(data),
+						std::move(retvalues), std::move(retindices), std::move(retpointers), format_type{});
+				};
 
-					using lhs_type = std::remove_reference_t<decltype(lhs)>;
-					using lhs_value_type = typename std::tuple_element_t<data_, lhs_type>::value_type;
+				// CSR copy of a compressed matrix
+				auto to_csr = [](const auto & data) {
+					if constexpr (traits_t<decltype(data)>::is_csr)
+						return std::remove_cv_t<std::remove_reference_t<decltype(data)> >(data);
+					else
+						return transpose_format(data);
+				};
 
-					using rhs_type = std::remove_reference_t<decltype(rhs)>;
-					using rhs_value_type = typename std::tuple_element_t<data_, rhs_type>::value_type;
+				// CSC copy of a compressed matrix
+				auto to_csc = [](const auto & data) {
+					if constexpr (!traits_t<decltype(data)>::is_csr)
+						return std::remove_cv_t<std::remove_reference_t<decltype(data)> >(data);
+					else
+						return transpose_format(data);
+				};
 
-					if constexpr (std::is_same_v<lhs_type, real::valued::matrix::_<lhs_value_type> > &&
-						std::is_same_v<rhs_type, real::valued::matrix::_<rhs_value_type> >) {
+				// major-axis ranges holding roughly equal numbers of nonzeros (boundaries of `parts` partitions)
+				auto balance = [](const std::vector<size_t> & pointers, size_t parts) {
+					std::vector<size_t> bounds{ 0u };
+					auto major_count{ pointers.size() - 1u };
+					auto nnz{ pointers.back() };
+					for (size_t p{ 1u }; p < parts; ++p) {
+						auto target{ nnz / parts * p };
+						auto major{ size_t(std::lower_bound(pointers.begin(), pointers.end(), target) - pointers.begin()) };
+						bounds.push_back(std::clamp(major, bounds.back(), major_count));
+					}
+					bounds.push_back(major_count);
+					return bounds;
+				};
 
-						if (real::valued::matrix::integrity_check(lhs) && real::valued::matrix::integrity_check(rhs)) {
-							if (std::get<number_of_columns_>(lhs) == std::get<number_of_rows_>(rhs)) {
+				// Gustavson row-by-row product of two compressed operands sharing the major axis: for CSR inputs it
+				// computes CSR(lhs * rhs); fed CSC(rhs) and CSC(lhs) it computes CSR((lhs * rhs)^T) = CSC(lhs * rhs)
+				auto gustavson = [](const auto & a, const auto & b, size_t major_count, size_t minor_count, auto format, size_t threads) {
+					using value_type = std::common_type_t<typename traits_t<decltype(a)>::value_type, typename traits_t<decltype(b)>::value_type>;
+					using index_type = typename traits_t<decltype(a)>::index_type;
+					const auto& ap{ std::get<pointers_>(a) };
+					const auto& ai{ std::get<indices_>(a) };
+					const auto& av{ std::get<data_>(a) };
+					const auto& bp{ std::get<pointers_>(b) };
+					const auto& bi{ std::get<indices_>(b) };
+					const auto& bv{ std::get<data_>(b) };
+					auto bounds{ balance(ap, std::max<size_t>(threads * 4u, 1u)) };
+					auto parts{ bounds.size() - 1u };
 
-								auto nrows{ std::get<number_of_rows_>(lhs) };
-								auto ncols{ std::get<number_of_columns_>(rhs) };
-								using return_value_type = std::common_type_t<lhs_value_type, rhs_value_type>;
-								auto retmat{ std::make_tuple(nrows,
-									ncols,
-									std::valarray<return_value_type>(return_value_type(0), nrows * ncols)) };
-
-								for (auto i{ 0u }; i < nrows; ++i) {
-									for (auto j{ 0u }; j < ncols; ++j) {
-
-										std::valarray<return_value_type> lhsi{ std::get<data_>(lhs)[std::slice(i * std::get<number_of_columns_>(lhs), std::get<number_of_columns_>(lhs), 1u)] };
-										std::valarray<return_value_type> rhsj{ std::get<data_>(rhs)[std::slice(j, std::get<number_of_rows_>(rhs), std::get<number_of_columns_>(rhs))] };
-										
-										std::get<data_>(retmat)[i * ncols + j] = std::transform_reduce(std::execution::seq,
-											std::begin(lhsi),
-											std::end(lhsi),
-											std::begin(rhsj),
-											return_value_type(0),
-											std::plus<return_value_type>(),
-											std::multiplies<return_value_type>());
+					std::vector<size_t> pointers(major_count + 1u, 0u);
+					concurrency::parallel_for(0u, parts, 1u, threads, [&](size_t first, size_t last) {
+						std::vector<size_t> marker(minor_count, std::numeric_limits<size_t>::max());
+						for (auto part{ first }; part < last; ++part)
+							for (auto i{ bounds[part] }; i < bounds[part + 1u]; ++i) {
+								size_t count{ 0u };
+								for (auto ka{ ap[i] }; ka < ap[i + 1u]; ++ka)
+									for (auto kb{ bp[ai[ka]] }; kb < bp[ai[ka] + 1u]; ++kb)
+										if (marker[bi[kb]] != i) {
+											marker[bi[kb]] = i;
+											++count;
+										}
+								pointers[i + 1u] = count;
+							}
+					});
+					std::partial_sum(pointers.begin(), pointers.end(), pointers.begin());
+
+					std::vector<index_type> indices(pointers.back());
+					std::vector<value_type> values(pointers.back());
+					concurrency::parallel_for(0u, parts, 1u, threads, [&](size_t first, size_t last) {
+						std::vector<value_type> accumulator(minor_count, value_type(0));
+						std::vector<size_t> marker(minor_count, std::numeric_limits<size_t>::max());
+						for (auto part{ first }; part < last; ++part)
+							for (auto i{ bounds[part] }; i < bounds[part + 1u]; ++i) {
+								auto* row{ indices.data() + pointers[i] };
+								size_t count{ 0u };
+								for (auto ka{ ap[i] }; ka < ap[i + 1u]; ++ka) {
+									auto x{ value_type(av[ka]) };
+									for (auto kb{ bp[ai[ka]] }; kb < bp[ai[ka] + 1u]; ++kb) {
+										auto j{ size_t(bi[kb]) };
+										if (marker[j] != i) {
+											marker[j] = i;
+											row[count++] = index_type(j);
+											accumulator[j] = x * value_type(bv[kb]);
+										}
+										else
+											accumulator[j] += x * value_type(bv[kb]);
 									}
 								}
-
-								return retmat;
+								std::sort(row, row + count);
+								for (size_t k{ 0u }; k < count; ++k)
+									values[pointers[i] + k] = accumulator[row[k]];
 							}
-							else
-								throw std::exception("Exception from real::valued:matrix::multiplication: "
-									"matrices dimensions are not compatible for matrix multiplication. "
-									"It means that the number of columns in the left-hand side matrix is not equal to "
-									"the number of rows in the right-hand side matrix.");
+					});
+					return std::make_tuple(std::move(values), std::move(indices), std::move(pointers), format);
+				};
+
+				// sparse matrix multiplication function:
+				//   sparse x dense vector (std::valarray / std::vector)  -> std::valarray
+				//   sparse x dense matrix (matrix, aligned matrix, view) -> matrix::_
+				//   sparse x sparse                                      -> sparse in the lhs format
+				auto multiplication = [](const auto & lhs, const auto & rhs, const auto &... policy) {
+					using lhs_traits = traits_t<decltype(lhs)>;
+					using rhs_type = std::remove_cv_t<std::remove_reference_t<decltype(rhs)> >;
+					static_assert(lhs_traits::is_sparse, "sparse::multiplication expects a sparse left-hand side");
+					using lhs_value_type = typename lhs_traits::value_type;
+					auto threads{ concurrency::degree(policy...) };
+					auto nrows{ std::get<number_of_rows_>(lhs) };
+					auto ncols{ std::get<number_of_columns_>(lhs) };
+					const auto& pointers{ std::get<pointers_>(lhs) };
+					const auto& indices{ std::get<indices_>(lhs) };
+					const auto& values{ std::get<data_>(lhs) };
+
+					if constexpr (traits<rhs_type>::is_sparse) {
+						if (ncols != std::get<number_of_rows_>(rhs))
+							throw std::runtime_error("Exception from real::valued:sparse::multiplication: "
+								"matrices dimensions are not compatible for matrix multiplication.");
+						auto rcols{ std::get<number_of_columns_>(rhs) };
+						if constexpr (lhs_traits::is_csr) {
+							auto product{ gustavson(lhs, to_csr(rhs), nrows, rcols, compressed_rows{}, threads) };
+							return std::tuple_cat(std::make_tuple(nrows, rcols), std::move(product));
 						}
-						else
-							throw std::exception("Exception from real::valued:matrix::multiplication: "
+						else {
+							auto product{ gustavson(to_csc(rhs), lhs, rcols, nrows, compressed_columns{}, threads) };
+							return std::tuple_cat(std::make_tuple(nrows, rcols), std::move(product));
+						}
+					}
+					else if constexpr (matrix::dense_traits<rhs_type>::is_dense) {
+						using rhs_traits = matrix::dense_traits<rhs_type>;
+						using return_value_type = std::common_type_t<lhs_value_type, typename rhs_traits::value_type>;
+						if (!matrix::integrity_check(rhs))
+							throw std::runtime_error("Exception from real::valued:sparse::multiplication: "
 								"matrix integrity adjustment is breached.");
+						if (ncols != std::get<number_of_rows_>(rhs))
+							throw std::runtime_error("Exception from real::valued:sparse::multiplication: "
+								"matrices dimensions are not compatible for matrix multiplication.");
+						// row-major streaming over rhs rows: a CSC lhs is converted to CSR first (O(nnz))
+						auto product = [&](const auto & a) {
+							const auto& ap{ std::get<pointers_>(a) };
+							const auto& ai{ std::get<indices_>(a) };
+							const auto& av{ std::get<data_>(a) };
+							auto rcols{ std::get<number_of_columns_>(rhs) };
+							auto retmat{ std::make_tuple(nrows, rcols, std::valarray<return_value_type>(return_value_type(0), nrows * rcols)) };
+							auto* c{ matrix::kernel::pointer(std::get<data_>(retmat)) };
+							const auto* b{ rhs_traits::pointer(rhs) };
+							auto rs{ rhs_traits::row_stride(rhs) };
+							auto cs{ rhs_traits::column_stride(rhs) };
+							auto bounds{ balance(ap, std::max<size_t>(threads * 4u, 1u)) };
+							concurrency::parallel_for(0u, bounds.size() - 1u, 1u, threads, [&](size_t first, size_t last) {
+								for (auto part{ first }; part < last; ++part)
+									for (auto i{ bounds[part] }; i < bounds[part + 1u]; ++i) {
+										auto* crow{ c + i * rcols };
+										for (auto k{ ap[i] }; k < ap[i + 1u]; ++k) {
+											auto x{ return_value_type(av[k]) };
+											const auto* brow{ b + std::ptrdiff_t(ai[k]) * rs };
+											if (cs == 1)
+												for (size_t j{ 0u }; j < rcols; ++j)
+													crow[j] += x * return_value_type(brow[j]);
+											else
+												for (size_t j{ 0u }; j < rcols; ++j)
+													crow[j] += x * return_value_type(brow[std::ptrdiff_t(j) * cs]);
+										}
+									}
+							});
+							return retmat;
+						};
+						if constexpr (lhs_traits::is_csr)
+							return product(lhs);
+						else
+							return product(to_csr(lhs));
+					}
+					else {
+						using rhs_value_type = std::remove_cv_t<std::remove_reference_t<decltype(rhs[0])> >;
+						using return_value_type = std::common_type_t<lhs_value_type, rhs_value_type>;
+						if (ncols != std::size(rhs))
+							throw std::runtime_error("Exception from real::valued:sparse::multiplication: "
+								"vector size is not compatible with the number of matrix columns.");
+						std::valarray<return_value_type> retvec(return_value_type(0), nrows);
+						if constexpr (lhs_traits::is_csr) {
+							auto bounds{ balance(pointers, std::max<size_t>(threads * 4u, 1u)) };
+							concurrency::parallel_for(0u, bounds.size() - 1u, 1u, threads, [&](size_t first, size_t last) {
+								for (auto part{ first }; part < last; ++part)
+									for (auto i{ bounds[part] }; i < bounds[part + 1u]; ++i) {
+										return_value_type acc{ 0 };
+										for (auto k{ pointers[i] }; k < pointers[i + 1u]; ++k)
+											acc += return_value_type(values[k]) * return_value_type(rhs[indices[k]]);
+										retvec[i] = acc;
+									}
+							});
+						}
+						else {
+							// column-major scatter: one nnz-balanced column range per participating thread, each into its
+							// own accumulator (the first into the result), then a parallel reduction over row ranges
+							auto parts{ std::clamp<size_t>(pointers.back() / concurrency::parallel_grain, 1u, threads) };
+							auto bounds{ balance(pointers, parts) };
+							std::vector<std::valarray<return_value_type> > partial(parts - 1u);
+							auto scatter = [&](size_t part) {
+								auto& acc{ part == 0u ? retvec : partial[part - 1u] };
+								if (part != 0u)
+									acc.resize(nrows, return_value_type(0));
+								for (auto j{ bounds[part] }; j < bounds[part + 1u]; ++j) {
+									auto x{ return_value_type(rhs[j]) };
+									for (auto k{ pointers[j] }; k < pointers[j + 1u]; ++k)
+										acc[indices[k]] += return_value_type(values[k]) * x;
+								}
+							};
+							if (parts == 1u)
+								scatter(0u);
+							else {
+								concurrency::parallel_for(0u, parts, 1u, parts, [&](size_t first, size_t last) {
+									for (auto part{ first }; part < last; ++part)
+										scatter(part);
+								});
+								concurrency::parallel_for(0u, nrows, std::max<size_t>(concurrency::parallel_grain / parts, 1u), threads, [&](size_t first, size_t last) {
+									for (const auto& p : partial)
+										for (auto i{ first }; i < last; ++i)
+											retvec[i] += p[i];
+								});
+							}
+						}
+						return retvec;
 					}
 				};
+
+				/***********************************************************************/
+				/* compressed sparse row space                                         */
+				/***********************************************************************/
+				namespace csr {
+
+					// CSR constructor from a container of (row, column, value) entries; duplicates are summed
+					auto constructor = [](size_t number_of_rows, size_t number_of_columns, const auto & entries) {
+						using entry_type = std::remove_cv_t<std::remove_reference_t<decltype(*std::begin(entries))> >;
+						using value_type = std::remove_cv_t<std::remove_reference_t<std::tuple_element_t<2u, entry_type> > >;
+						return compress(number_of_rows, number_of_columns, compressed_rows{}, std::uint32_t{}, value_type{}, entries);
+					};
+
+					// CSR copy of a dense operand (entries with |x| <= tolerance are dropped)
+					auto from_dense = [](const auto & mat, const auto &... tolerance) {
+						using value_type = typename matrix::dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(mat)> > >::value_type;
+						return sparse::from_dense(mat, compressed_rows{}, std::uint32_t{}, value_type((value_type(0) + ... + tolerance)));
+					};
+				}
+
+				/***********************************************************************/
+				/* compressed sparse column space                                      */
+				/***********************************************************************/
+				namespace csc {
+
+					// CSC constructor from a container of (row, column, value) entries; duplicates are summed
+					auto constructor = [](size_t number_of_rows, size_t number_of_columns, const auto & entries) {
+						using entry_type = std::remove_cv_t<std::remove_reference_t<decltype(*std::begin(entries))> >;
+						using value_type = std::remove_cv_t<std::remove_reference_t<std::tuple_element_t<2u, entry_type> > >;
+						return compress(number_of_rows, number_of_columns, compressed_columns{}, std::uint32_t{}, value_type{}, entries);
+					};
+
+					// CSC copy of a dense operand (entries with |x| <= tolerance are dropped)
+					auto from_dense = [](const auto & mat, const auto &... tolerance) {
+						using value_type = typename matrix::dense_traits<std::remove_cv_t<std::remove_reference_t<decltype(mat)> > >::value_type;
+						return sparse::from_dense(mat, compressed_columns{}, std::uint32_t{}, value_type((value_type(0) + ... + tolerance)));
+					};
+				}
 			}
 		}
 	}
 }
+
+// heap allocation probe: with HPMX_INSTRUMENTATION_NEW defined before including this header in exactly one
+// translation unit, the global allocation functions are replaced to charge every allocation to the innermost
+// measured call of the allocating thread. The replacements stay out of line: inlined, their malloc/free bodies
+// would be paired against the new/delete expressions of the caller (-Wmismatched-new-delete)
+#if defined(HPMX_INSTRUMENTATION) && defined(HPMX_INSTRUMENTATION_NEW)
+#if defined(__GNUC__)
+#define HPMX_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define HPMX_NOINLINE __declspec(noinline)
+#else
+#define HPMX_NOINLINE
+#endif
+HPMX_NOINLINE void* operator new(std::size_t size) {
+	::hpmx::instrumentation::allocation(size);
+	if (auto* p{ std::malloc(size == 0u ? 1u : size) })
+		return p;
+	throw std::bad_alloc{};
+}
+HPMX_NOINLINE void* operator new[](std::size_t size) {
+	return ::operator new(size);
+}
+HPMX_NOINLINE void* operator new(std::size_t size, std::align_val_t alignment) {
+	::hpmx::instrumentation::allocation(size);
+	auto a{ std::max(size_t(alignment), sizeof(void*)) };
+#if defined(_WIN32)
+	// the CRT has no aligned_alloc; its aligned blocks must be released with _aligned_free
+	if (auto* p{ _aligned_malloc(std::max(size, size_t(1u)), a) })
+		return p;
+#else
+	if (auto* p{ std::aligned_alloc(a, (std::max(size, size_t(1u)) + a - 1u) / a * a) })
+		return p;
+#endif
+	throw std::bad_alloc{};
+}
+HPMX_NOINLINE void* operator new[](std::size_t size, std::align_val_t alignment) {
+	return ::operator new(size, alignment);
+}
+HPMX_NOINLINE void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+	try { return ::operator new(size); }
+	catch (...) { return nullptr; }
+}
+HPMX_NOINLINE void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+	try { return ::operator new(size); }
+	catch (...) { return nullptr; }
+}
+HPMX_NOINLINE void operator delete(void* p) noexcept { std::free(p); }
+HPMX_NOINLINE void operator delete[](void* p) noexcept { std::free(p); }
+HPMX_NOINLINE void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+HPMX_NOINLINE void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+#if defined(_WIN32)
+HPMX_NOINLINE void operator delete(void* p, std::align_val_t) noexcept { _aligned_free(p); }
+#else
+HPMX_NOINLINE void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+#endif
+HPMX_NOINLINE void operator delete[](void* p, std::align_val_t alignment) noexcept { ::operator delete(p, alignment); }
+HPMX_NOINLINE void operator delete(void* p, std::size_t, std::align_val_t alignment) noexcept { ::operator delete(p, alignment); }
+HPMX_NOINLINE void operator delete[](void* p, std::size_t, std::align_val_t alignment) noexcept { ::operator delete(p, alignment); }
+#endif
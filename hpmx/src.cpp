@@ -4,8 +4,11 @@
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <sstream>
 #include <random>
+#include <filesystem>
 
+#define HPMX_INSTRUMENTATION_NEW
 #include "hpmx.h"
 
 using namespace hpmx;
@@ -118,6 +121,161 @@ void real_valued_matrix_test(void) {
 
 	auto mat18{ real::valued::matrix::multiplication(mat16, mat17) };
 	real::valued::matrix::display("\n--------------------\n\nmat18", mat18);
+
+	auto mat19{ real::valued::matrix::multiplication(mat16, mat17, std::execution::par) };
+	real::valued::matrix::display("\n--------------------\n\nmat19", mat19);
+
+	auto mat20{ real::valued::matrix::addition(mat12, mat13, concurrency::threads{ 2u }) };
+	real::valued::matrix::display("\n--------------------\n\nmat20", mat20);
+
+	auto fn13 = [](int u) { return u * u; };
+	auto expr0{ real::valued::matrix::lazy::apply(real::valued::matrix::lazy::addition(mat14, mat15), fn13) };
+	auto mat21{ real::valued::matrix::lazy::evaluate(expr0 * 2 - mat12) };
+	real::valued::matrix::display("\n--------------------\n\nmat21", mat21);
+
+	memory::pool pool0;
+	auto amat0{ real::valued::matrix::aligned::from_matrix(mat16, real::valued::matrix::aligned::padded, &pool0) };
+	auto amat1{ real::valued::matrix::aligned::from_matrix(mat17, &pool0) };
+	auto amat2{ real::valued::matrix::aligned::multiplication(amat0, amat1) };
+	real::valued::matrix::aligned::display("\n--------------------\n\namat2", amat2);
+
+	auto view0{ real::valued::matrix::view::transpose(mat16) };
+	auto mat22{ real::valued::matrix::multiplication(view0, mat16) };
+	real::valued::matrix::display("\n--------------------\n\nmat22", mat22);
+
+	real::valued::matrix::set::row(real::valued::matrix::view::block(mat22, 0u, 1u, 2u, 1u), 1u, -1);
+	auto mat23{ real::valued::matrix::addition(real::valued::matrix::view::column(mat22, 1u), real::valued::matrix::view::column(mat22, 0u)) };
+	real::valued::matrix::display("\n--------------------\n\nmat23", mat23);
+
+	constexpr auto fmat0{ real::valued::matrix::fixed::constructor<2u, 3u>(std::array<int, 6u>{ 1, 2, 3, 4, 5, 6 }) };
+	constexpr auto fmat1{ real::valued::matrix::fixed::multiplication(fmat0, real::valued::matrix::fixed::identity<int, 3u>) };
+	auto fmat2{ real::valued::matrix::fixed::addition(fmat1, real::valued::matrix::fixed::from_dynamic<2u, 3u>(real::valued::matrix::view::block(mat4, 0u, 0u, 2u, 3u))) };
+	real::valued::matrix::fixed::display("\n--------------------\n\nfmat2", fmat2);
+
+	auto smat0{ real::valued::sparse::csr::constructor(3u, 3u, std::vector<std::tuple<size_t, size_t, double> >{ { 0u, 0u, 2.0 }, { 1u, 2u, -1.0 }, { 2u, 1u, 4.0 }, { 1u, 2u, 0.5 } }) };
+	auto smat1{ real::valued::sparse::csc::from_dense(mat15) };
+	auto smat2{ real::valued::sparse::multiplication(smat0, real::valued::sparse::to_csr(smat1), std::execution::par) };
+	real::valued::matrix::display("\n--------------------\n\nsmat2", real::valued::sparse::to_dense(smat2));
+	auto mat24{ real::valued::sparse::multiplication(smat0, mat16, concurrency::threads{ 2u }) };
+	real::valued::matrix::display("\n--------------------\n\nmat24", mat24);
+	auto svec0{ real::valued::sparse::multiplication(smat0, std::valarray<double>{ 1.0, 2.0, 3.0 }) };
+	real::valued::matrix::display("\n--------------------\n\nsvec0", std::make_tuple(svec0.size(), size_t(1u), svec0));
+
+	auto path0{ (std::filesystem::temp_directory_path() / "hpmx_mat16.bin").string() };
+	auto path1{ (std::filesystem::temp_directory_path() / "hpmx_mat25.bin").string() };
+	real::valued::matrix::mapped::save(path0, mat16);
+	auto mmat0{ real::valued::matrix::mapped::open<int>(path0) };
+	auto mmat1{ real::valued::matrix::mapped::multiplication(path1, mmat0, mat17, real::valued::matrix::mapped::budget{ 1u << 20u }, std::execution::par) };
+	real::valued::matrix::mapped::display("\n--------------------\n\nmmat1", mmat1);
+	auto mat25{ real::valued::matrix::addition(mmat0, mat16) };
+	real::valued::matrix::display("\n--------------------\n\nmat25", mat25);
+
+	auto mat26{ real::valued::matrix::constructor(3u, 4u, 0) };
+	real::valued::matrix::multiplication(mat16, mat17, real::valued::matrix::into(mat26));
+	real::valued::matrix::axpy(2, mat18, mat26);
+	real::valued::matrix::sub_inplace(mat26, mat19, std::execution::par);
+	real::valued::matrix::apply_inplace(mat26, [](int x) { return x / 2; });
+	real::valued::matrix::display("\n--------------------\n\nmat26", mat26);
+	auto mat27{ real::valued::matrix::addition(real::valued::matrix::apply(mat12, fn13), mat13) };
+	real::valued::matrix::display("\n--------------------\n\nmat27", mat27);
+
+	auto mat28{ real::valued::matrix::transpose(mat18, std::execution::par) };
+	real::valued::matrix::display("\n--------------------\n\nmat28", mat28);
+	real::valued::matrix::transpose_inplace(mat22);
+	real::valued::matrix::transpose_inplace(mat28);
+	auto mat29{ real::valued::matrix::multiplication_tn(mat16, mat16) };
+	real::valued::matrix::display("\n--------------------\n\nmat29", mat29);
+	auto mat30{ real::valued::matrix::multiplication_nt(mat16, mat16) };
+	real::valued::matrix::multiplication_tt(mat17, mat16, real::valued::matrix::into(mat28));
+	real::valued::matrix::display("\n--------------------\n\nmat28", mat28);
+	real::valued::matrix::display("\n--------------------\n\nmat30", mat30);
+
+	auto bmat0{ real::valued::matrix::batched::constructor(3u, 2u, 3u, std::vector<int>{ 1, 2, 3, 4, 5, 6, 0, 1, 0, 1, 0, 1, -1, 0, 2, 0, -1, 3 }) };
+	auto bmat1{ real::valued::matrix::batched::strided(&std::as_const(std::get<real::valued::matrix::data_>(mat16))[0], 3u, 2u, 3u, 0) };
+	auto bmat2{ real::valued::matrix::batched::multiplication(bmat0, bmat1, std::execution::par) };
+	real::valued::matrix::batched::display("\n--------------------\n\nbmat2", bmat2);
+
+	auto mat31{ real::valued::matrix::constructor(3u, 3u, std::vector<double>{ 4.0, 2.0, -2.0, 2.0, 10.0, 4.0, -2.0, 4.0, 9.0 }) };
+	auto lu0{ real::valued::matrix::lu::factorization(mat31) };
+	auto mat32{ real::valued::matrix::lu::solve(lu0, mat16, std::execution::par) };
+	real::valued::matrix::display("\n--------------------\n\nmat32", mat32);
+	auto chol0{ real::valued::matrix::cholesky::factorization(mat31) };
+	real::valued::matrix::display("\n--------------------\n\nchol0", chol0);
+	auto mat33{ real::valued::matrix::cholesky::solve(chol0, mat16) };
+	auto mat34{ real::valued::matrix::solve(mat31, real::valued::matrix::multiplication(mat31, mat16)) };
+	real::valued::matrix::display("\n--------------------\n\nmat34", mat34);
+	auto residual{ std::abs(std::get<real::valued::matrix::data_>(real::valued::matrix::subtraction(mat33, mat32))).max() };
+	auto lu1{ real::valued::matrix::lu::factorization(real::valued::matrix::constructor(2u, 2u, std::vector<double>{ 1.0, 2.0, 2.0, 4.0 })) };
+	std::cout << "\ndet(mat31) = " << real::valued::matrix::lu::determinant(lu0) << ", |mat33 - mat32| = " << residual
+		<< ", det(singular) = " << real::valued::matrix::lu::determinant(lu1) << std::endl;
+	if (residual > 1e-12)
+		throw std::runtime_error("Exception from real_valued_matrix_test: the LU and Cholesky solutions differ.");
+	if (real::valued::matrix::lu::determinant(lu1) != 0.0)
+		throw std::runtime_error("Exception from real_valued_matrix_test: a singular matrix has a nonzero determinant.");
+
+	auto mat35{ real::valued::matrix::constructor(2u, 3u, std::vector<precision::bfloat16>{
+		precision::bfloat16(1.5f), precision::bfloat16(-2.0f), precision::bfloat16(0.25f),
+		precision::bfloat16(3.0f), precision::bfloat16(1.0f), precision::bfloat16(-0.5f) }) };
+	auto mat36{ real::valued::matrix::constructor(3u, 2u, precision::float16(0.5f)) };
+	auto mat37{ real::valued::matrix::multiplication(mat35, mat36, std::execution::par) };
+	real::valued::matrix::display("\n--------------------\n\nmat37", mat37);
+	real::valued::matrix::display("\n--------------------\n\n2 * mat35", real::valued::matrix::apply(mat35, [](float x) { return 2.0f * x; }));
+	auto qmat0{ real::valued::matrix::constructor(2u, 3u, std::vector<float>{ 1.5f, -2.0f, 0.25f, 3.0f, 1.0f, -0.5f }, real::valued::matrix::quantized::tag) };
+	auto qmat1{ real::valued::matrix::quantized::quantize(mat36) };
+	real::valued::matrix::display("\n--------------------\n\nqmat0", qmat0);
+	auto mat38{ real::valued::matrix::multiplication(qmat0, qmat1) };
+	real::valued::matrix::display("\n--------------------\n\nmat38", mat38);
+
+	auto mat39{ real::valued::matrix::generator(3u, 4u, [](size_t i, size_t j) { return double(i == j) + 0.5 * double(j); }, std::execution::par) };
+	real::valued::matrix::display("\n--------------------\n\nmat39", mat39);
+	auto mat40{ real::valued::matrix::generator(2u, 3u, [](size_t k) { return int(k * k); }) };
+	real::valued::matrix::display("\n--------------------\n\nmat40", mat40);
+	auto mat41{ real::valued::matrix::random::uniform(3u, 3u, 2021u, -1.0, 1.0) };
+	auto mat42{ real::valued::matrix::random::uniform(3u, 3u, 2021u, -1.0, 1.0, concurrency::threads{ 4u }) };
+	auto mat43{ real::valued::matrix::random::normal(2u, 5u, 2021u, 0.0f, 1.0f, std::execution::par) };
+	real::valued::matrix::display("\n--------------------\n\nmat41", mat41);
+	real::valued::matrix::display("\n--------------------\n\nmat43", mat43);
+	std::cout << "\nmat41 == mat42: " << std::boolalpha
+		<< (std::get<real::valued::matrix::data_>(mat41) == std::get<real::valued::matrix::data_>(mat42)).min() << std::endl;
+
+	auto [imax, jmax] { real::valued::matrix::reduce::argmax(mat39) };
+	std::cout << "\nsum(mat39) = " << real::valued::matrix::reduce::sum(mat39, std::execution::par)
+		<< ", mean(mat39) = " << real::valued::matrix::reduce::mean(mat39, real::valued::matrix::reduce::compensated)
+		<< ", min(mat39) = " << real::valued::matrix::reduce::min(mat39)
+		<< ", argmax(mat39) = (" << imax << ", " << jmax << ")"
+		<< ", trace(mat39) = " << real::valued::matrix::reduce::trace(mat39)
+		<< ", dot(mat39, mat39) = " << real::valued::matrix::reduce::dot(mat39, mat39) << std::endl;
+	auto row_sums{ real::valued::matrix::reduce::row::sum(mat39) };
+	auto column_max{ real::valued::matrix::reduce::column::max(mat39, std::execution::par) };
+	std::cout << "row sums of mat39:";
+	for (auto x : row_sums)
+		std::cout << ' ' << x;
+	std::cout << "\ncolumn maxima of mat39:";
+	for (auto x : column_max)
+		std::cout << ' ' << x;
+	std::cout << "\nnorms of mat39: frobenius " << real::valued::matrix::reduce::norm::frobenius(mat39)
+		<< ", l1 " << real::valued::matrix::reduce::norm::l1(mat39)
+		<< ", linf " << real::valued::matrix::reduce::norm::linf(mat39) << std::endl;
+
+	auto left{ real::valued::matrix::async::multiplication(mat39, real::valued::matrix::view::transpose(mat39)) };
+	auto right{ real::valued::matrix::async::multiplication(mat39, real::valued::matrix::view::transpose(mat39), real::valued::matrix::async::tiles{ 2u }) };
+	auto both{ real::valued::matrix::async::addition(left, right) };
+	real::valued::matrix::display("\n--------------------\n\nasync mat39 * mat39^T + mat39 * mat39^T", both.get());
+
+	std::stringstream csv;
+	real::valued::matrix::text::write(csv, mat43, std::execution::par);
+	auto mat44{ real::valued::matrix::text::read<float>(csv, std::execution::par) };
+	std::cout << "\nmat43 == text::read(text::write(mat43)): " << std::boolalpha
+		<< (std::get<real::valued::matrix::data_>(mat43) == std::get<real::valued::matrix::data_>(mat44)).min() << std::endl;
+
+	std::cout << "\nkernel instruction set: " << real::valued::matrix::kernel::isa_name(real::valued::matrix::kernel::host_simd_width())
+		<< ", gemm blocking (float): " << real::valued::matrix::tuning::current().single.mc << " x "
+		<< real::valued::matrix::tuning::current().single.kc << " x " << real::valued::matrix::tuning::current().single.nc << std::endl;
+
+	if constexpr (instrumentation::enabled) {
+		std::cout << "\ninstrumentation counters:\n";
+		instrumentation::write_csv(std::cout, instrumentation::snapshot());
+	}
 }
 
 // entry point